@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstring>
 #include "audio_core/cubeb_sink.h"
@@ -78,27 +79,35 @@ public:
             // Downsample 6 channels to 2
             ASSERT_MSG(source_num_channels == 6, "Channel count must be 6");
 
-            std::vector<s16> buf;
-            buf.reserve(samples.size() * num_channels / source_num_channels);
-            for (std::size_t i = 0; i < samples.size(); i += source_num_channels) {
+            // Downmix in small chunks pushed straight to the ring to avoid allocations on the
+            // audio path
+            constexpr std::size_t chunk_frames = 256;
+            std::array<s16, chunk_frames * 2> chunk;
+            std::size_t chunk_size = 0;
+            for (std::size_t i = 0; i + source_num_channels <= samples.size();
+                 i += source_num_channels) {
                 // Downmixing implementation taken from the ATSC standard
-                const s16 left{samples[i + 0]};
-                const s16 right{samples[i + 1]};
-                const s16 center{samples[i + 2]};
-                const s16 surround_left{samples[i + 4]};
-                const s16 surround_right{samples[i + 5]};
+                const s32 left{samples[i + 0]};
+                const s32 right{samples[i + 1]};
+                const s32 center{samples[i + 2]};
+                const s32 surround_left{samples[i + 4]};
+                const s32 surround_right{samples[i + 5]};
                 // Not used in the ATSC reference implementation
                 [[maybe_unused]] const s16 low_frequency_effects{samples[i + 3]};
 
                 constexpr s32 clev{707}; // center mixing level coefficient
                 constexpr s32 slev{707}; // surround mixing level coefficient
 
-                buf.push_back(static_cast<s16>(left + (clev * center / 1000) +
-                                               (slev * surround_left / 1000)));
-                buf.push_back(static_cast<s16>(right + (clev * center / 1000) +
-                                               (slev * surround_right / 1000)));
+                chunk[chunk_size++] = static_cast<s16>(left + (clev * center / 1000) +
+                                                       (slev * surround_left / 1000));
+                chunk[chunk_size++] = static_cast<s16>(right + (clev * center / 1000) +
+                                                       (slev * surround_right / 1000));
+                if (chunk_size == chunk.size()) {
+                    queue.Push(chunk.data(), chunk_size);
+                    chunk_size = 0;
+                }
             }
-            queue.Push(buf);
+            queue.Push(chunk.data(), chunk_size);
             return;
         }
 
@@ -0,0 +1,36 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "audio_core/algorithm/interpolate.h"
+#include "common/common_types.h"
+
+namespace AudioCore {
+
+TEST_CASE("Resample", "[audio_core]") {
+    constexpr std::size_t sample_count = 240;
+
+    // Pitches are Q15 ratios between the input and output sample rates
+    for (const s32 pitch : {0x5555, 0x8000, 0xC000}) {
+        const std::size_t input_count = (sample_count * pitch >> 15) + 4;
+        std::vector<s32> input(input_count);
+        for (std::size_t i = 0; i < input_count; ++i) {
+            input[i] = static_cast<s32>((i * 1237) % 0x10000) - 0x8000;
+        }
+        std::vector<s32> output(sample_count);
+
+        BENCHMARK("240 samples at pitch 0x" + std::to_string(pitch)) {
+            s32 fraction = 0;
+            Resample(output.data(), input.data(), pitch, fraction, sample_count);
+            return fraction;
+        };
+    }
+}
+
+} // namespace AudioCore
@@ -0,0 +1,28 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "common/cityhash.h"
+
+namespace Common {
+
+TEST_CASE("CityHash64", "[common]") {
+    for (const std::size_t size : {16U, 256U, 4096U, 1U << 20}) {
+        std::vector<char> data(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<char>(i * 31);
+        }
+
+        BENCHMARK(std::to_string(size) + " bytes") {
+            return CityHash64(data.data(), data.size());
+        };
+    }
+}
+
+} // namespace Common
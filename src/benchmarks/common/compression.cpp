@@ -0,0 +1,58 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "common/common_types.h"
+#include "common/lz4_compression.h"
+#include "common/zstd_compression.h"
+
+namespace Common::Compression {
+
+namespace {
+
+/// Generates a megabyte of data that compresses roughly like game assets do
+std::vector<u8> MakeCompressibleData() {
+    constexpr std::size_t size = 1 << 20;
+    std::mt19937 rng{1234};
+    std::vector<u8> data(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<u8>((rng() % 4 == 0) ? rng() : i / 64);
+    }
+    return data;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("LZ4", "[common]") {
+    const std::vector<u8> data = MakeCompressibleData();
+    const std::vector<u8> compressed = CompressDataLZ4(data.data(), data.size());
+
+    BENCHMARK("Compress 1 MiB") {
+        return CompressDataLZ4(data.data(), data.size());
+    };
+
+    BENCHMARK("Decompress 1 MiB") {
+        return DecompressDataLZ4(compressed, data.size());
+    };
+}
+
+TEST_CASE("Zstd", "[common]") {
+    const std::vector<u8> data = MakeCompressibleData();
+    const std::vector<u8> compressed = CompressDataZSTDDefault(data.data(), data.size());
+
+    BENCHMARK("Compress 1 MiB") {
+        return CompressDataZSTDDefault(data.data(), data.size());
+    };
+
+    BENCHMARK("Decompress 1 MiB") {
+        return DecompressDataZSTD(compressed);
+    };
+}
+
+} // namespace Common::Compression
@@ -0,0 +1,51 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <functional>
+#include <memory>
+
+#include <catch2/catch.hpp>
+
+#include "common/fiber.h"
+
+namespace Common {
+
+namespace {
+
+struct PingPong {
+    std::shared_ptr<Fiber> thread_fiber;
+    std::shared_ptr<Fiber> work_fiber;
+};
+
+void PingPongWork(void* param) {
+    auto* const ping_pong = static_cast<PingPong*>(param);
+    while (true) {
+        Fiber::YieldTo(ping_pong->work_fiber, ping_pong->thread_fiber);
+    }
+}
+
+} // Anonymous namespace
+
+TEST_CASE("Fiber::YieldTo", "[common]") {
+    PingPong ping_pong;
+    ping_pong.thread_fiber = Fiber::ThreadToFiber();
+    ping_pong.work_fiber =
+        std::make_shared<Fiber>(std::function<void(void*)>{PingPongWork}, &ping_pong);
+
+    BENCHMARK("Round trip") {
+        Fiber::YieldTo(ping_pong.thread_fiber, ping_pong.work_fiber);
+    };
+
+    BENCHMARK("Round trip with raw pointers") {
+        Fiber::YieldTo(ping_pong.thread_fiber.get(), ping_pong.work_fiber.get());
+    };
+
+    BENCHMARK("Create and destroy") {
+        return std::make_shared<Fiber>(std::function<void(void*)>{PingPongWork}, &ping_pong);
+    };
+
+    ping_pong.thread_fiber->Exit();
+}
+
+} // namespace Common
@@ -0,0 +1,35 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <catch2/catch.hpp>
+
+#include "common/common_types.h"
+#include "common/multi_level_queue.h"
+
+namespace Common {
+
+TEST_CASE("MultiLevelQueue", "[common]") {
+    constexpr u32 num_elements = 256;
+
+    MultiLevelQueue<u32, 64> queue;
+    for (u32 i = 0; i < num_elements; ++i) {
+        queue.add(i, i % 64);
+    }
+
+    BENCHMARK("add and remove") {
+        queue.add(num_elements, 31);
+        queue.remove(num_elements, 31);
+    };
+
+    BENCHMARK("front") {
+        return queue.front();
+    };
+
+    BENCHMARK("adjust") {
+        queue.adjust(0, 0, 63);
+        queue.adjust(0, 63, 0, true);
+    };
+}
+
+} // namespace Common
@@ -0,0 +1,46 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+#include "common/common_types.h"
+#include "common/ring_buffer.h"
+
+namespace Common {
+
+TEST_CASE("RingBuffer", "[common]") {
+    // Stereo samples, the way the audio sinks use it
+    constexpr std::size_t frame_size = 240;
+    RingBuffer<s16, 0x4000, 2> buffer;
+    std::array<s16, frame_size * 2> frame{};
+
+    BENCHMARK("Push and Pop 240 frames") {
+        const std::size_t pushed = buffer.Push(frame.data(), frame_size);
+        return pushed + buffer.Pop(frame.data(), frame_size);
+    };
+
+    BENCHMARK("Push and Pop 240 frames with a concurrent reader") {
+        std::atomic_bool done{false};
+        std::thread reader([&buffer, &done] {
+            std::array<s16, frame_size * 2> output;
+            while (!done.load(std::memory_order_relaxed) || buffer.Size() != 0) {
+                buffer.Pop(output.data(), frame_size);
+            }
+        });
+        for (std::size_t i = 0; i < 64; ++i) {
+            while (buffer.Push(frame.data(), frame_size) == 0) {
+                std::this_thread::yield();
+            }
+        }
+        done = true;
+        reader.join();
+    };
+}
+
+} // namespace Common
@@ -0,0 +1,57 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "core/core_timing.h"
+
+namespace {
+
+struct ScopeInit final {
+    ScopeInit() {
+        core_timing.SetMulticore(true);
+        core_timing.Initialize([]() {});
+    }
+    ~ScopeInit() {
+        core_timing.Shutdown();
+    }
+
+    Core::Timing::CoreTiming core_timing;
+};
+
+void EmptyCallback(std::uintptr_t, std::chrono::nanoseconds) {}
+
+} // Anonymous namespace
+
+TEST_CASE("CoreTiming::ScheduleEvent", "[core]") {
+    using namespace std::chrono_literals;
+
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+
+    // Keep a realistic amount of pending events in the queue
+    std::vector<std::shared_ptr<Core::Timing::EventType>> background_events;
+    for (int i = 0; i < 32; ++i) {
+        auto& event = background_events.emplace_back(
+            Core::Timing::CreateEvent("Background" + std::to_string(i), EmptyCallback));
+        core_timing.ScheduleEvent(std::chrono::seconds{60 + i}, event);
+    }
+
+    const auto event = Core::Timing::CreateEvent("Benchmark", EmptyCallback);
+
+    BENCHMARK("Schedule and unschedule") {
+        core_timing.ScheduleEvent(30s, event);
+        core_timing.UnscheduleEvent(event, 0);
+    };
+
+    for (const auto& background_event : background_events) {
+        core_timing.UnscheduleEvent(background_event, 0);
+    }
+}
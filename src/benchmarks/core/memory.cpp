@@ -0,0 +1,79 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "common/common_types.h"
+#include "common/page_table.h"
+#include "core/core.h"
+#include "core/hle/kernel/memory/page_table.h"
+#include "core/hle/kernel/process.h"
+#include "core/memory.h"
+
+namespace {
+
+constexpr VAddr BASE_ADDRESS = 0x10000000;
+constexpr std::size_t REGION_SIZE = 16 * Core::Memory::PAGE_SIZE;
+
+/**
+ * Memory instance reading and writing a region of host memory mapped directly into the page table
+ * of a process that is never registered with the kernel. Only pages of the Memory type are mapped,
+ * so no access reaches the GPU or any other subsystem of the uninitialized system.
+ */
+class MappedMemory {
+public:
+    explicit MappedMemory(Core::System& system)
+        : memory{system}, process{std::make_shared<Kernel::Process>(system)},
+          backing(REGION_SIZE) {
+        Common::PageTable& page_table = process->PageTable().PageTableImpl();
+        page_table.Resize(32, Core::Memory::PAGE_BITS, true);
+
+        for (std::size_t offset = 0; offset < REGION_SIZE; offset += Core::Memory::PAGE_SIZE) {
+            const VAddr vaddr = BASE_ADDRESS + offset;
+            const std::size_t page = vaddr >> Core::Memory::PAGE_BITS;
+            page_table.pointers[page] = backing.data() + offset - vaddr;
+            page_table.attributes[page] = Common::PageType::Memory;
+        }
+    }
+
+    Core::Memory::Memory& Memory() {
+        return memory;
+    }
+
+    const Kernel::Process& Process() const {
+        return *process;
+    }
+
+private:
+    Core::Memory::Memory memory;
+    std::shared_ptr<Kernel::Process> process;
+    std::vector<u8> backing;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("Memory::ReadBlock and WriteBlock", "[core]") {
+    // The system is only referenced by the constructors, it is never initialized
+    MappedMemory mapped{Core::System::GetInstance()};
+    auto& memory = mapped.Memory();
+
+    for (const std::size_t size : {64U, 4096U, 16U * 4096U}) {
+        std::vector<u8> buffer(size);
+        // Misalign the larger copies so that they cross page boundaries
+        const VAddr address = BASE_ADDRESS + (size == REGION_SIZE ? 0 : 0x800);
+
+        BENCHMARK("ReadBlock " + std::to_string(size) + " bytes") {
+            memory.ReadBlock(mapped.Process(), address, buffer.data(), size);
+        };
+
+        BENCHMARK("WriteBlock " + std::to_string(size) + " bytes") {
+            memory.WriteBlock(mapped.Process(), address, buffer.data(), size);
+        };
+    }
+}
@@ -0,0 +1,104 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+/// Escapes a string to be used as a JSON string literal
+std::string Escape(std::string_view text) {
+    std::string result;
+    result.reserve(text.size());
+    for (const char c : text) {
+        switch (c) {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        default:
+            result += c;
+            break;
+        }
+    }
+    return result;
+}
+
+/// Catch reporter writing the statistics of every benchmark as a JSON document
+class JsonReporter final : public Catch::StreamingReporterBase<JsonReporter> {
+public:
+    using StreamingReporterBase::StreamingReporterBase;
+
+    static std::string getDescription() {
+        return "Reports benchmark results as JSON";
+    }
+
+    void assertionStarting(const Catch::AssertionInfo&) override {}
+
+    bool assertionEnded(const Catch::AssertionStats&) override {
+        return true;
+    }
+
+    void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override {
+        results.push_back(Result{
+            .test_case = currentTestCaseInfo->name,
+            .name = stats.info.name,
+            .samples = stats.samples.size(),
+            .iterations = stats.info.iterations,
+            .mean_ns = stats.mean.point.count(),
+            .mean_lower_ns = stats.mean.lower_bound.count(),
+            .mean_upper_ns = stats.mean.upper_bound.count(),
+            .std_dev_ns = stats.standardDeviation.point.count(),
+            .outlier_variance = stats.outlierVariance,
+        });
+    }
+
+    void testRunEnded(const Catch::TestRunStats& stats) override {
+        stream << "{\n  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const Result& result = results[i];
+            stream << (i == 0 ? "\n" : ",\n") << "    {\"test_case\": \""
+                   << Escape(result.test_case) << "\", \"name\": \"" << Escape(result.name)
+                   << "\", \"samples\": " << result.samples
+                   << ", \"iterations\": " << result.iterations
+                   << ", \"mean_ns\": " << result.mean_ns
+                   << ", \"mean_lower_ns\": " << result.mean_lower_ns
+                   << ", \"mean_upper_ns\": " << result.mean_upper_ns
+                   << ", \"std_dev_ns\": " << result.std_dev_ns
+                   << ", \"outlier_variance\": " << result.outlier_variance << "}";
+        }
+        stream << "\n  ]\n}\n";
+        StreamingReporterBase::testRunEnded(stats);
+    }
+
+private:
+    struct Result {
+        std::string test_case;
+        std::string name;
+        std::size_t samples;
+        int iterations;
+        double mean_ns;
+        double mean_lower_ns;
+        double mean_upper_ns;
+        double std_dev_ns;
+        double outlier_variance;
+    };
+
+    std::vector<Result> results;
+};
+
+} // Anonymous namespace
+
+CATCH_REGISTER_REPORTER("json", JsonReporter)
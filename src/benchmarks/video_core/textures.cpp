@@ -0,0 +1,60 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "common/common_types.h"
+#include "video_core/textures/astc.h"
+#include "video_core/textures/decoders.h"
+
+namespace Tegra::Texture {
+
+namespace {
+
+std::vector<u8> MakeRandomData(std::size_t size) {
+    std::mt19937 rng{5678};
+    std::vector<u8> data(size);
+    for (u8& value : data) {
+        value = static_cast<u8>(rng());
+    }
+    return data;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("UnswizzleTexture", "[video_core]") {
+    constexpr u32 width = 1024;
+    constexpr u32 height = 1024;
+
+    for (const u32 bytes_per_pixel : {1U, 4U, 16U}) {
+        std::vector<u8> swizzled = MakeRandomData(width * height * bytes_per_pixel);
+        std::vector<u8> unswizzled(swizzled.size());
+
+        BENCHMARK("1024x1024 " + std::to_string(bytes_per_pixel) + " bytes per pixel") {
+            UnswizzleTexture(unswizzled.data(), swizzled.data(), 1, 1, bytes_per_pixel, width,
+                             height, 1);
+        };
+    }
+}
+
+TEST_CASE("ASTC::Decompress", "[video_core]") {
+    constexpr u32 width = 256;
+    constexpr u32 height = 256;
+
+    // Random blocks exercise a mix of block modes, partitions and error blocks
+    for (const u32 block_size : {4U, 8U}) {
+        const std::size_t num_blocks = (width / block_size) * (height / block_size);
+        const std::vector<u8> data = MakeRandomData(num_blocks * 16);
+
+        BENCHMARK("256x256 " + std::to_string(block_size) + "x" + std::to_string(block_size)) {
+            return ASTC::Decompress(data.data(), width, height, 1, block_size, block_size);
+        };
+    }
+}
+
+} // namespace Tegra::Texture
@@ -7,6 +7,10 @@
 #if defined(_WIN32) || defined(WIN32)
 #include <windows.h>
 #else
+#include <mutex>
+#include <vector>
+#include <sys/mman.h>
+#include <unistd.h>
 #include <boost/context/detail/fcontext.hpp>
 #endif
 
@@ -91,11 +95,12 @@ void Fiber::Rewind() {
     SwitchToFiber(impl->rewind_handle);
 }
 
-void Fiber::YieldTo(std::shared_ptr<Fiber> from, std::shared_ptr<Fiber> to) {
+void Fiber::YieldTo(Fiber* from, Fiber* to) {
     ASSERT_MSG(from != nullptr, "Yielding fiber is null!");
     ASSERT_MSG(to != nullptr, "Next fiber is null!");
     to->guard.lock();
-    to->previous_fiber = from;
+    // Holds 'from' alive until it has been unlocked, an exiting thread may drop its last reference
+    to->previous_fiber = from->shared_from_this();
     SwitchToFiber(to->impl->handle);
     ASSERT(from->previous_fiber != nullptr);
     from->previous_fiber->guard.unlock();
@@ -112,13 +117,79 @@ std::shared_ptr<Fiber> Fiber::ThreadToFiber() {
 
 #else
 
+namespace {
+
+/**
+ * Recycles fiber stacks so that creating and destroying guest threads doesn't have to allocate
+ * and clear a new stack every time. Stacks are carved out of a single reserved region, each one
+ * placed above a guard page so that overflows fault instead of corrupting a neighbour.
+ */
+class FiberStackPool {
+public:
+    static FiberStackPool& Instance() {
+        // Intentionally leaked, fibers may be destroyed during static destruction
+        static FiberStackPool* const pool = new FiberStackPool;
+        return *pool;
+    }
+
+    /// Returns the lowest usable address of a stack of default_stack_size bytes
+    u8* Acquire() {
+        std::scoped_lock lock{mutex};
+        if (!free_stacks.empty()) {
+            u8* const stack = free_stacks.back();
+            free_stacks.pop_back();
+            return stack;
+        }
+        if (region != nullptr && next_slot < max_slots) {
+            u8* const stack = region + next_slot * slot_size + guard_size;
+            ++next_slot;
+            const int result = mprotect(stack, default_stack_size, PROT_READ | PROT_WRITE);
+            ASSERT_MSG(result == 0, "Failed to commit a fiber stack");
+            return stack;
+        }
+        // The reserved region is exhausted, map a standalone stack
+        void* const base = mmap(nullptr, slot_size, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        ASSERT_MSG(base != MAP_FAILED, "Failed to allocate a fiber stack");
+        mprotect(base, guard_size, PROT_NONE);
+        return static_cast<u8*>(base) + guard_size;
+    }
+
+    void Release(u8* stack) {
+        std::scoped_lock lock{mutex};
+        free_stacks.push_back(stack);
+    }
+
+private:
+    static constexpr std::size_t max_slots = 1024;
+
+    FiberStackPool()
+        : guard_size{static_cast<std::size_t>(sysconf(_SC_PAGESIZE))},
+          slot_size{guard_size + default_stack_size} {
+        void* const base = mmap(nullptr, max_slots * slot_size, PROT_NONE,
+                                MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (base != MAP_FAILED) {
+            region = static_cast<u8*>(base);
+        }
+        free_stacks.reserve(max_slots);
+    }
+
+    const std::size_t guard_size;
+    const std::size_t slot_size;
+    u8* region = nullptr;
+    std::size_t next_slot = 0;
+
+    std::mutex mutex;
+    std::vector<u8*> free_stacks;
+};
+
+} // Anonymous namespace
+
 struct Fiber::FiberImpl {
-    alignas(64) std::array<u8, default_stack_size> stack;
-    alignas(64) std::array<u8, default_stack_size> rewind_stack;
-    u8* stack_limit;
-    u8* rewind_stack_limit;
-    boost::context::detail::fcontext_t context;
-    boost::context::detail::fcontext_t rewind_context;
+    u8* stack_limit = nullptr;
+    u8* rewind_stack_limit = nullptr;
+    boost::context::detail::fcontext_t context = nullptr;
+    boost::context::detail::fcontext_t rewind_context = nullptr;
 };
 
 void Fiber::Start(boost::context::detail::transfer_t& transfer) {
@@ -154,11 +225,10 @@ void Fiber::RewindStartFunc(boost::context::detail::transfer_t transfer) {
 Fiber::Fiber(std::function<void(void*)>&& entry_point_func, void* start_parameter)
     : entry_point{std::move(entry_point_func)}, start_parameter{start_parameter} {
     impl = std::make_unique<FiberImpl>();
-    impl->stack_limit = impl->stack.data();
-    impl->rewind_stack_limit = impl->rewind_stack.data();
+    impl->stack_limit = FiberStackPool::Instance().Acquire();
     u8* stack_base = impl->stack_limit + default_stack_size;
     impl->context =
-        boost::context::detail::make_fcontext(stack_base, impl->stack.size(), FiberStartFunc);
+        boost::context::detail::make_fcontext(stack_base, default_stack_size, FiberStartFunc);
 }
 
 void Fiber::SetRewindPoint(std::function<void(void*)>&& rewind_func, void* start_parameter) {
@@ -178,6 +248,16 @@ Fiber::~Fiber() {
     if (locked) {
         guard.unlock();
     }
+    if (!impl) {
+        return;
+    }
+    auto& pool = FiberStackPool::Instance();
+    if (impl->stack_limit != nullptr) {
+        pool.Release(impl->stack_limit);
+    }
+    if (impl->rewind_stack_limit != nullptr) {
+        pool.Release(impl->rewind_stack_limit);
+    }
 }
 
 void Fiber::Exit() {
@@ -193,18 +273,22 @@ void Fiber::Exit() {
 void Fiber::Rewind() {
     ASSERT(rewind_point);
     ASSERT(impl->rewind_context == nullptr);
+    if (impl->rewind_stack_limit == nullptr) {
+        impl->rewind_stack_limit = FiberStackPool::Instance().Acquire();
+    }
     u8* stack_base = impl->rewind_stack_limit + default_stack_size;
     impl->rewind_context =
-        boost::context::detail::make_fcontext(stack_base, impl->stack.size(), RewindStartFunc);
+        boost::context::detail::make_fcontext(stack_base, default_stack_size, RewindStartFunc);
     boost::context::detail::jump_fcontext(impl->rewind_context, this);
 }
 
-void Fiber::YieldTo(std::shared_ptr<Fiber> from, std::shared_ptr<Fiber> to) {
+void Fiber::YieldTo(Fiber* from, Fiber* to) {
     ASSERT_MSG(from != nullptr, "Yielding fiber is null!");
     ASSERT_MSG(to != nullptr, "Next fiber is null!");
     to->guard.lock();
-    to->previous_fiber = from;
-    auto transfer = boost::context::detail::jump_fcontext(to->impl->context, to.get());
+    // Holds 'from' alive until it has been unlocked, an exiting thread may drop its last reference
+    to->previous_fiber = from->shared_from_this();
+    auto transfer = boost::context::detail::jump_fcontext(to->impl->context, to);
     ASSERT(from->previous_fiber != nullptr);
     from->previous_fiber->impl->context = transfer.fctx;
     from->previous_fiber->guard.unlock();
@@ -219,4 +303,9 @@ std::shared_ptr<Fiber> Fiber::ThreadToFiber() {
 }
 
 #endif
+
+void Fiber::YieldTo(const std::shared_ptr<Fiber>& from, const std::shared_ptr<Fiber>& to) {
+    YieldTo(from.get(), to.get());
+}
+
 } // namespace Common
@@ -33,7 +33,7 @@ namespace Common {
  * thread and then from it switch to the expected fiber. This way you can exchange
  * 2 fibers within 2 different threads.
  */
-class Fiber {
+class Fiber : public std::enable_shared_from_this<Fiber> {
 public:
     Fiber(std::function<void(void*)>&& entry_point_func, void* start_parameter);
     ~Fiber();
@@ -46,7 +46,12 @@ public:
 
     /// Yields control from Fiber 'from' to Fiber 'to'
     /// Fiber 'from' must be the currently running fiber.
-    static void YieldTo(std::shared_ptr<Fiber> from, std::shared_ptr<Fiber> to);
+    static void YieldTo(const std::shared_ptr<Fiber>& from, const std::shared_ptr<Fiber>& to);
+
+    /// Same as above without copying the callers' references, for hot paths like the scheduler.
+    /// 'from' is kept alive until the destination fiber has released it, 'to' has to be kept
+    /// alive by the caller.
+    static void YieldTo(Fiber* from, Fiber* to);
     [[nodiscard]] static std::shared_ptr<Fiber> ThreadToFiber();
 
     void SetRewindPoint(std::function<void(void*)>&& rewind_func, void* start_parameter);
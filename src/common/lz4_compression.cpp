@@ -73,4 +73,13 @@ std::vector<u8> DecompressDataLZ4(const std::vector<u8>& compressed,
     return uncompressed;
 }
 
+bool DecompressDataLZ4(const u8* compressed, std::size_t compressed_size, u8* uncompressed,
+                       std::size_t uncompressed_size) {
+    const int size_check = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed),
+                                               reinterpret_cast<char*>(uncompressed),
+                                               static_cast<int>(compressed_size),
+                                               static_cast<int>(uncompressed_size));
+    return static_cast<int>(uncompressed_size) == size_check;
+}
+
 } // namespace Common::Compression
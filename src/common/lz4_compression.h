@@ -56,4 +56,17 @@ namespace Common::Compression {
 [[nodiscard]] std::vector<u8> DecompressDataLZ4(const std::vector<u8>& compressed,
                                                 std::size_t uncompressed_size);
 
+/**
+ * Decompresses a source memory region with LZ4 into a caller provided memory region.
+ *
+ * @param compressed        the compressed source memory region.
+ * @param compressed_size   the size in bytes of the compressed data.
+ * @param uncompressed      the destination memory region.
+ * @param uncompressed_size the size in bytes of the uncompressed data.
+ *
+ * @return true if exactly uncompressed_size bytes were decompressed.
+ */
+[[nodiscard]] bool DecompressDataLZ4(const u8* compressed, std::size_t compressed_size,
+                                     u8* uncompressed, std::size_t uncompressed_size);
+
 } // namespace Common::Compression
\ No newline at end of file
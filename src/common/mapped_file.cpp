@@ -0,0 +1,104 @@
+// Copyright 2020 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#include "common/string_util.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "common/mapped_file.h"
+
+namespace Common {
+
+MappedFile::MappedFile(const std::string& path) {
+#ifdef _WIN32
+    const HANDLE file = CreateFileW(UTF8ToUTF16W(path).c_str(), GENERIC_READ,
+                                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        return;
+    }
+    mapping_handle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping_handle == nullptr) {
+        return;
+    }
+    base = static_cast<const u8*>(MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
+    if (base == nullptr) {
+        CloseHandle(mapping_handle);
+        mapping_handle = nullptr;
+        return;
+    }
+    size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+        close(fd);
+        return;
+    }
+    const auto file_size = static_cast<std::size_t>(file_stat.st_size);
+    void* const pointer = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+    if (pointer == MAP_FAILED) {
+        return;
+    }
+    base = static_cast<const u8*>(pointer);
+    size = file_size;
+#endif
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& rhs) noexcept
+    : base{std::exchange(rhs.base, nullptr)}, size{std::exchange(rhs.size, 0)} {
+#ifdef _WIN32
+    mapping_handle = std::exchange(rhs.mapping_handle, nullptr);
+#endif
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& rhs) noexcept {
+    Close();
+    base = std::exchange(rhs.base, nullptr);
+    size = std::exchange(rhs.size, 0);
+#ifdef _WIN32
+    mapping_handle = std::exchange(rhs.mapping_handle, nullptr);
+#endif
+    return *this;
+}
+
+void MappedFile::Close() {
+    if (base == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(base);
+    CloseHandle(mapping_handle);
+    mapping_handle = nullptr;
+#else
+    munmap(const_cast<u8*>(base), size);
+#endif
+    base = nullptr;
+    size = 0;
+}
+
+} // namespace Common
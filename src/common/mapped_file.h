@@ -0,0 +1,54 @@
+// Copyright 2020 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+
+namespace Common {
+
+/// Read-only view of a whole host file mapped into memory
+class MappedFile final : NonCopyable {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(MappedFile&& rhs) noexcept;
+    MappedFile& operator=(MappedFile&& rhs) noexcept;
+
+    /// Unmaps the file, the view is empty afterwards
+    void Close();
+
+    /// Returns true when the file was mapped. Empty files are never mapped.
+    [[nodiscard]] bool IsOpen() const noexcept {
+        return base != nullptr;
+    }
+
+    [[nodiscard]] const u8* Data() const noexcept {
+        return base;
+    }
+
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return size;
+    }
+
+    [[nodiscard]] std::span<const u8> Span() const noexcept {
+        return {base, size};
+    }
+
+private:
+    const u8* base = nullptr;
+    std::size_t size = 0;
+#ifdef _WIN32
+    void* mapping_handle = nullptr;
+#endif
+};
+
+} // namespace Common
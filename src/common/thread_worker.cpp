@@ -0,0 +1,68 @@
+// Copyright 2020 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+
+#include "common/thread.h"
+#include "common/thread_worker.h"
+
+namespace Common {
+
+ThreadWorker::ThreadWorker(std::size_t num_workers, const std::string& name) {
+    if (num_workers == 0) {
+        num_workers = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    threads.reserve(num_workers);
+    for (std::size_t i = 0; i < num_workers; ++i) {
+        threads.emplace_back([this, name] {
+            SetCurrentThreadName(name.c_str());
+            while (true) {
+                std::function<void()> work;
+                {
+                    std::unique_lock lock{queue_mutex};
+                    condition.wait(lock, [this] { return stop || !requests.empty(); });
+                    if (requests.empty()) {
+                        // Only reached when stopping
+                        return;
+                    }
+                    work = std::move(requests.front());
+                    requests.pop();
+                }
+                work();
+                {
+                    std::scoped_lock lock{queue_mutex};
+                    --work_remaining;
+                }
+                wait_condition.notify_all();
+            }
+        });
+    }
+}
+
+ThreadWorker::~ThreadWorker() {
+    {
+        std::scoped_lock lock{queue_mutex};
+        stop = true;
+    }
+    condition.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void ThreadWorker::QueueWork(std::function<void()>&& work) {
+    {
+        std::scoped_lock lock{queue_mutex};
+        requests.emplace(std::move(work));
+        ++work_remaining;
+    }
+    condition.notify_one();
+}
+
+void ThreadWorker::WaitForRequests() {
+    std::unique_lock lock{queue_mutex};
+    wait_condition.wait(lock, [this] { return work_remaining == 0; });
+}
+
+} // namespace Common
@@ -0,0 +1,53 @@
+// Copyright 2020 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Common {
+
+/// Fixed set of host threads executing queued work in submission order
+class ThreadWorker final {
+public:
+    /**
+     * Creates the worker threads
+     * @param num_workers Number of threads to spawn, the host concurrency is used when zero
+     * @param name Name given to the spawned threads
+     */
+    explicit ThreadWorker(std::size_t num_workers, const std::string& name);
+    ~ThreadWorker();
+
+    ThreadWorker(const ThreadWorker&) = delete;
+    ThreadWorker& operator=(const ThreadWorker&) = delete;
+
+    /// Queues work to be executed by the first available thread
+    void QueueWork(std::function<void()>&& work);
+
+    /// Blocks until all the queued work has been executed
+    void WaitForRequests();
+
+    /// Returns the number of worker threads
+    [[nodiscard]] std::size_t NumWorkers() const noexcept {
+        return threads.size();
+    }
+
+private:
+    std::vector<std::thread> threads;
+    std::queue<std::function<void()>> requests;
+    std::mutex queue_mutex;
+    std::condition_variable condition;
+    std::condition_variable wait_condition;
+    std::size_t work_remaining = 0;
+    bool stop = false;
+};
+
+} // namespace Common
@@ -33,12 +33,15 @@ std::vector<u8> CompressDataZSTDDefault(const u8* source, std::size_t source_siz
 }
 
 std::vector<u8> DecompressDataZSTD(const std::vector<u8>& compressed) {
-    const std::size_t decompressed_size =
-        ZSTD_getDecompressedSize(compressed.data(), compressed.size());
+    return DecompressDataZSTD(compressed.data(), compressed.size());
+}
+
+std::vector<u8> DecompressDataZSTD(const u8* source, std::size_t source_size) {
+    const std::size_t decompressed_size = ZSTD_getDecompressedSize(source, source_size);
     std::vector<u8> decompressed(decompressed_size);
 
-    const std::size_t uncompressed_result_size = ZSTD_decompress(
-        decompressed.data(), decompressed.size(), compressed.data(), compressed.size());
+    const std::size_t uncompressed_result_size =
+        ZSTD_decompress(decompressed.data(), decompressed.size(), source, source_size);
 
     if (decompressed_size != uncompressed_result_size || ZSTD_isError(uncompressed_result_size)) {
         // Decompression failed
@@ -42,4 +42,14 @@ namespace Common::Compression {
  */
 [[nodiscard]] std::vector<u8> DecompressDataZSTD(const std::vector<u8>& compressed);
 
+/**
+ * Decompresses a source memory region with Zstandard and returns the uncompressed data in a vector.
+ *
+ * @param source the compressed source memory region.
+ * @param source_size the size of the compressed source memory region.
+ *
+ * @return the decompressed data.
+ */
+[[nodiscard]] std::vector<u8> DecompressDataZSTD(const u8* source, std::size_t source_size);
+
 } // namespace Common::Compression
\ No newline at end of file
@@ -282,6 +282,14 @@ struct System::Impl {
                                         perf_results.frametime * 1000.0);
             telemetry_session->AddField(performance, "Mean_Frametime_MS",
                                         perf_stats->GetMeanFrametime());
+            telemetry_session->AddField(performance, "Shutdown_FramePacingJitter",
+                                        perf_results.frame_pacing_jitter * 1000.0);
+            telemetry_session->AddField(performance, "Shutdown_MaxFrameInterval",
+                                        perf_results.max_frame_interval * 1000.0);
+            telemetry_session->AddField(performance, "Shutdown_GPUWaitTime",
+                                        perf_results.gpu_wait_time * 1000.0);
+            telemetry_session->AddField(performance, "Shutdown_DroppedFrames",
+                                        perf_results.dropped_frames);
         }
 
         lm_manager.Flush();
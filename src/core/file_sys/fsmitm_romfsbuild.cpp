@@ -24,8 +24,14 @@
 
 #include <cstring>
 #include <string_view>
+#include <unordered_set>
+#include <utility>
 #include "common/alignment.h"
 #include "common/assert.h"
+#include "common/cityhash.h"
+#include "common/common_funcs.h"
+#include "common/file_util.h"
+#include "common/logging/log.h"
 #include "core/file_sys/fsmitm_romfsbuild.h"
 #include "core/file_sys/ips_layer.h"
 #include "core/file_sys/vfs.h"
@@ -38,6 +44,9 @@ constexpr u64 FS_MAX_PATH = 0x301;
 constexpr u32 ROMFS_ENTRY_EMPTY = 0xFFFFFFFF;
 constexpr u32 ROMFS_FILEPARTITION_OFS = 0x200;
 
+constexpr u32 METADATA_CACHE_MAGIC = Common::MakeMagic('Y', 'R', 'F', 'S');
+constexpr u32 METADATA_CACHE_VERSION = 1;
+
 // Types for building a RomFS.
 struct RomFSHeader {
     u64 header_size;
@@ -109,6 +118,73 @@ static u32 romfs_calc_path_hash(u32 parent, std::string_view path, u32 start,
     return hash;
 }
 
+struct RomFSMetadataCacheHeader {
+    u32 magic;
+    u32 version;
+    u64 layout_hash;
+    u64 checksum;
+    u64 metadata_size;
+};
+static_assert(sizeof(RomFSMetadataCacheHeader) == 0x20,
+              "RomFSMetadataCacheHeader has incorrect size.");
+
+static u64 romfs_metadata_checksum(const std::vector<u8>& header_data,
+                                   const std::vector<u8>& metadata) {
+    const u64 header_hash = Common::CityHash64(reinterpret_cast<const char*>(header_data.data()),
+                                               header_data.size());
+    return Common::CityHash64WithSeed(reinterpret_cast<const char*>(metadata.data()),
+                                      metadata.size(), header_hash);
+}
+
+static bool romfs_load_metadata_cache(const std::string& path, u64 layout_hash,
+                                      std::vector<u8>& header_data, std::vector<u8>& metadata) {
+    Common::FS::IOFile file(path, "rb");
+    if (!file.IsOpen()) {
+        return false;
+    }
+
+    RomFSMetadataCacheHeader cache_header{};
+    if (file.ReadBytes(&cache_header, sizeof(cache_header)) != sizeof(cache_header) ||
+        cache_header.magic != METADATA_CACHE_MAGIC ||
+        cache_header.version != METADATA_CACHE_VERSION ||
+        cache_header.layout_hash != layout_hash ||
+        file.GetSize() != sizeof(cache_header) + sizeof(RomFSHeader) + cache_header.metadata_size) {
+        return false;
+    }
+
+    header_data.resize(sizeof(RomFSHeader));
+    metadata.resize(cache_header.metadata_size);
+    if (file.ReadBytes(header_data.data(), header_data.size()) != header_data.size() ||
+        file.ReadBytes(metadata.data(), metadata.size()) != metadata.size() ||
+        romfs_metadata_checksum(header_data, metadata) != cache_header.checksum) {
+        LOG_WARNING(Loader, "Ignoring invalid RomFS metadata cache at path={}", path);
+        return false;
+    }
+    return true;
+}
+
+static void romfs_save_metadata_cache(const std::string& path, u64 layout_hash,
+                                      const std::vector<u8>& header_data,
+                                      const std::vector<u8>& metadata) {
+    if (!Common::FS::CreateFullPath(path)) {
+        LOG_ERROR(Loader, "Failed to create the directory of path={}", path);
+        return;
+    }
+    Common::FS::IOFile file(path, "wb");
+    const RomFSMetadataCacheHeader cache_header{
+        .magic = METADATA_CACHE_MAGIC,
+        .version = METADATA_CACHE_VERSION,
+        .layout_hash = layout_hash,
+        .checksum = romfs_metadata_checksum(header_data, metadata),
+        .metadata_size = metadata.size(),
+    };
+    if (!file.IsOpen() || file.WriteObject(cache_header) != 1 ||
+        file.WriteBytes(header_data.data(), header_data.size()) != header_data.size() ||
+        file.WriteBytes(metadata.data(), metadata.size()) != metadata.size()) {
+        LOG_ERROR(Loader, "Failed to write RomFS metadata cache to path={}", path);
+    }
+}
+
 static u64 romfs_get_hash_table_count(u64 num_entries) {
     if (num_entries < 3) {
         return 3;
@@ -126,69 +202,70 @@ static u64 romfs_get_hash_table_count(u64 num_entries) {
     return count;
 }
 
-void RomFSBuildContext::VisitDirectory(VirtualDir root_romfs, VirtualDir ext,
+void RomFSBuildContext::VisitDirectory(VirtualDir dir, VirtualDir ext,
                                        std::shared_ptr<RomFSBuildDirectoryContext> parent) {
-    std::vector<std::shared_ptr<RomFSBuildDirectoryContext>> child_dirs;
-
-    VirtualDir dir;
-
-    if (parent->path_len == 0)
-        dir = root_romfs;
-    else
-        dir = root_romfs->GetDirectoryRelative(parent->path);
-
-    const auto entries = dir->GetEntries();
-
-    for (const auto& kv : entries) {
-        if (kv.second == VfsEntryType::Directory) {
-            const auto child = std::make_shared<RomFSBuildDirectoryContext>();
-            // Set child's path.
-            child->cur_path_ofs = parent->path_len + 1;
-            child->path_len = child->cur_path_ofs + static_cast<u32>(kv.first.size());
-            child->path = parent->path + "/" + kv.first;
-
-            if (ext != nullptr && ext->GetFileRelative(child->path + ".stub") != nullptr)
-                continue;
+    std::vector<std::pair<std::shared_ptr<RomFSBuildDirectoryContext>, VirtualDir>> child_dirs;
+
+    // Entries are taken from the listings of dir, resolving each path from the root again is slow
+    // on layered directories with many entries.
+    std::unordered_set<std::string> dir_names;
+    for (auto& subdir : dir->GetSubdirectories()) {
+        const auto child = std::make_shared<RomFSBuildDirectoryContext>();
+        const std::string name = subdir->GetName();
+        // Set child's path.
+        child->cur_path_ofs = parent->path_len + 1;
+        child->path_len = child->cur_path_ofs + static_cast<u32>(name.size());
+        child->path = parent->path + "/" + name;
+        dir_names.insert(name);
+
+        if (ext != nullptr && ext->GetFileRelative(child->path + ".stub") != nullptr)
+            continue;
+
+        // Sanity check on path_len
+        ASSERT(child->path_len < FS_MAX_PATH);
+
+        if (AddDirectory(parent, child)) {
+            child_dirs.emplace_back(child, std::move(subdir));
+        }
+    }
 
-            // Sanity check on path_len
-            ASSERT(child->path_len < FS_MAX_PATH);
+    for (auto& file : dir->GetFiles()) {
+        const std::string name = file->GetName();
+        // Directories take precedence over files with the same name
+        if (dir_names.contains(name))
+            continue;
 
-            if (AddDirectory(parent, child)) {
-                child_dirs.push_back(child);
-            }
-        } else {
-            const auto child = std::make_shared<RomFSBuildFileContext>();
-            // Set child's path.
-            child->cur_path_ofs = parent->path_len + 1;
-            child->path_len = child->cur_path_ofs + static_cast<u32>(kv.first.size());
-            child->path = parent->path + "/" + kv.first;
+        const auto child = std::make_shared<RomFSBuildFileContext>();
+        // Set child's path.
+        child->cur_path_ofs = parent->path_len + 1;
+        child->path_len = child->cur_path_ofs + static_cast<u32>(name.size());
+        child->path = parent->path + "/" + name;
 
-            if (ext != nullptr && ext->GetFileRelative(child->path + ".stub") != nullptr)
-                continue;
+        if (ext != nullptr && ext->GetFileRelative(child->path + ".stub") != nullptr)
+            continue;
 
-            // Sanity check on path_len
-            ASSERT(child->path_len < FS_MAX_PATH);
+        // Sanity check on path_len
+        ASSERT(child->path_len < FS_MAX_PATH);
 
-            child->source = root_romfs->GetFileRelative(child->path);
+        child->source = std::move(file);
 
-            if (ext != nullptr) {
-                const auto ips = ext->GetFileRelative(child->path + ".ips");
+        if (ext != nullptr) {
+            const auto ips = ext->GetFileRelative(child->path + ".ips");
 
-                if (ips != nullptr) {
-                    auto patched = PatchIPS(child->source, ips);
-                    if (patched != nullptr)
-                        child->source = std::move(patched);
-                }
+            if (ips != nullptr) {
+                auto patched = PatchIPS(child->source, ips);
+                if (patched != nullptr)
+                    child->source = std::move(patched);
             }
+        }
 
-            child->size = child->source->GetSize();
+        child->size = child->source->GetSize();
 
-            AddFile(parent, child);
-        }
+        AddFile(parent, child);
     }
 
-    for (auto& child : child_dirs) {
-        this->VisitDirectory(root_romfs, ext, child);
+    for (auto& [child, subdir] : child_dirs) {
+        this->VisitDirectory(std::move(subdir), ext, child);
     }
 }
 
@@ -240,7 +317,56 @@ RomFSBuildContext::RomFSBuildContext(VirtualDir base_, VirtualDir ext_)
 
 RomFSBuildContext::~RomFSBuildContext() = default;
 
-std::multimap<u64, VirtualFile> RomFSBuildContext::Build() {
+u64 RomFSBuildContext::GetLayoutHash() const {
+    // The metadata only depends on the paths and sizes of the entries, not on their contents
+    u64 hash = num_dirs ^ (num_files << 32);
+    for (const auto& [path, dir] : directories) {
+        hash = Common::CityHash64WithSeed(path.data(), path.size(), hash);
+    }
+    for (const auto& [path, file] : files) {
+        hash = Common::CityHash64WithSeed(path.data(), path.size(), hash ^ file->size);
+    }
+    return hash;
+}
+
+std::multimap<u64, VirtualFile> RomFSBuildContext::Build(const std::string& metadata_cache_path) {
+    std::multimap<u64, VirtualFile> out;
+
+    // Determine file offsets.
+    u32 entry_offset = 0;
+    for (const auto& it : files) {
+        const auto& cur_file = it.second;
+        file_partition_size = Common::AlignUp(file_partition_size, 16);
+        cur_file->offset = file_partition_size;
+        file_partition_size += cur_file->size;
+        cur_file->entry_offset = entry_offset;
+        entry_offset +=
+            static_cast<u32>(sizeof(RomFSFileEntry) +
+                             Common::AlignUp(cur_file->path_len - cur_file->cur_path_ofs, 4));
+        out.emplace(cur_file->offset + ROMFS_FILEPARTITION_OFS, cur_file->source);
+    }
+
+    std::vector<u8> header_data;
+    std::vector<u8> metadata;
+    if (metadata_cache_path.empty()) {
+        BuildMetadata(header_data, metadata);
+    } else {
+        const u64 layout_hash = GetLayoutHash();
+        if (!romfs_load_metadata_cache(metadata_cache_path, layout_hash, header_data, metadata)) {
+            BuildMetadata(header_data, metadata);
+            romfs_save_metadata_cache(metadata_cache_path, layout_hash, header_data, metadata);
+        }
+    }
+
+    RomFSHeader header{};
+    std::memcpy(&header, header_data.data(), sizeof(RomFSHeader));
+    out.emplace(0, std::make_shared<VectorVfsFile>(std::move(header_data)));
+    out.emplace(header.dir_hash_table_ofs, std::make_shared<VectorVfsFile>(std::move(metadata)));
+
+    return out;
+}
+
+void RomFSBuildContext::BuildMetadata(std::vector<u8>& header_data, std::vector<u8>& metadata) {
     const u64 dir_hash_table_entry_count = romfs_get_hash_table_count(num_dirs);
     const u64 file_hash_table_entry_count = romfs_get_hash_table_count(num_files);
     dir_hash_table_size = 4 * dir_hash_table_entry_count;
@@ -257,20 +383,6 @@ std::multimap<u64, VirtualFile> RomFSBuildContext::Build() {
 
     std::shared_ptr<RomFSBuildFileContext> cur_file;
 
-    // Determine file offsets.
-    u32 entry_offset = 0;
-    std::shared_ptr<RomFSBuildFileContext> prev_file = nullptr;
-    for (const auto& it : files) {
-        cur_file = it.second;
-        file_partition_size = Common::AlignUp(file_partition_size, 16);
-        cur_file->offset = file_partition_size;
-        file_partition_size += cur_file->size;
-        cur_file->entry_offset = entry_offset;
-        entry_offset +=
-            static_cast<u32>(sizeof(RomFSFileEntry) +
-                             Common::AlignUp(cur_file->path_len - cur_file->cur_path_ofs, 4));
-        prev_file = cur_file;
-    }
     // Assign deferred parent/sibling ownership.
     for (auto it = files.rbegin(); it != files.rend(); ++it) {
         cur_file = it->second;
@@ -281,7 +393,7 @@ std::multimap<u64, VirtualFile> RomFSBuildContext::Build() {
     std::shared_ptr<RomFSBuildDirectoryContext> cur_dir;
 
     // Determine directory offsets.
-    entry_offset = 0;
+    u32 entry_offset = 0;
     for (const auto& it : directories) {
         cur_dir = it.second;
         cur_dir->entry_offset = entry_offset;
@@ -296,8 +408,6 @@ std::multimap<u64, VirtualFile> RomFSBuildContext::Build() {
         cur_dir->parent->child = cur_dir;
     }
 
-    std::multimap<u64, VirtualFile> out;
-
     // Populate file tables.
     for (const auto& it : files) {
         cur_file = it.second;
@@ -317,7 +427,6 @@ std::multimap<u64, VirtualFile> RomFSBuildContext::Build() {
 
         cur_entry.name_size = name_size;
 
-        out.emplace(cur_file->offset + ROMFS_FILEPARTITION_OFS, cur_file->source);
         std::memcpy(file_table.data() + cur_file->entry_offset, &cur_entry, sizeof(RomFSFileEntry));
         std::memset(file_table.data() + cur_file->entry_offset + sizeof(RomFSFileEntry), 0,
                     Common::AlignUp(cur_entry.name_size, 4));
@@ -365,12 +474,10 @@ std::multimap<u64, VirtualFile> RomFSBuildContext::Build() {
     header.file_hash_table_ofs = header.dir_table_ofs + header.dir_table_size;
     header.file_table_ofs = header.file_hash_table_ofs + header.file_hash_table_size;
 
-    std::vector<u8> header_data(sizeof(RomFSHeader));
+    header_data.resize(sizeof(RomFSHeader));
     std::memcpy(header_data.data(), &header, header_data.size());
-    out.emplace(0, std::make_shared<VectorVfsFile>(std::move(header_data)));
 
-    std::vector<u8> metadata(file_hash_table_size + file_table_size + dir_hash_table_size +
-                             dir_table_size);
+    metadata.resize(file_hash_table_size + file_table_size + dir_hash_table_size + dir_table_size);
     std::size_t index = 0;
     std::memcpy(metadata.data(), dir_hash_table.data(), dir_hash_table.size() * sizeof(u32));
     index += dir_hash_table.size() * sizeof(u32);
@@ -380,9 +487,6 @@ std::multimap<u64, VirtualFile> RomFSBuildContext::Build() {
                 file_hash_table.size() * sizeof(u32));
     index += file_hash_table.size() * sizeof(u32);
     std::memcpy(metadata.data() + index, file_table.data(), file_table.size());
-    out.emplace(header.dir_hash_table_ofs, std::make_shared<VectorVfsFile>(std::move(metadata)));
-
-    return out;
 }
 
 } // namespace FileSys
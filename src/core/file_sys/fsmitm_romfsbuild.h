@@ -27,6 +27,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 #include "common/common_types.h"
 #include "core/file_sys/vfs.h"
 
@@ -42,8 +43,9 @@ public:
     explicit RomFSBuildContext(VirtualDir base, VirtualDir ext = nullptr);
     ~RomFSBuildContext();
 
-    // This finalizes the context.
-    std::multimap<u64, VirtualFile> Build();
+    // This finalizes the context. When a cache path is given, the metadata tables are loaded from
+    // it if the paths and sizes of the entries did not change, and stored to it otherwise.
+    std::multimap<u64, VirtualFile> Build(const std::string& metadata_cache_path = {});
 
 private:
     VirtualDir base;
@@ -59,9 +61,12 @@ private:
     u64 file_hash_table_size = 0;
     u64 file_partition_size = 0;
 
-    void VisitDirectory(VirtualDir filesys, VirtualDir ext,
+    void VisitDirectory(VirtualDir dir, VirtualDir ext,
                         std::shared_ptr<RomFSBuildDirectoryContext> parent);
 
+    u64 GetLayoutHash() const;
+    void BuildMetadata(std::vector<u8>& header_data, std::vector<u8>& metadata);
+
     bool AddDirectory(std::shared_ptr<RomFSBuildDirectoryContext> parent_dir_ctx,
                       std::shared_ptr<RomFSBuildDirectoryContext> dir_ctx);
     bool AddFile(std::shared_ptr<RomFSBuildDirectoryContext> parent_dir_ctx,
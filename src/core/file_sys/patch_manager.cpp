@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <cstring>
 
+#include "common/common_paths.h"
 #include "common/file_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
@@ -397,7 +398,11 @@ static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType t
 
     auto layered_ext = LayeredVfsDirectory::MakeLayeredDirectory(std::move(layers_ext));
 
-    auto packed = CreateRomFS(std::move(layered), std::move(layered_ext));
+    const auto metadata_cache_path =
+        fmt::format("{}layeredfs" DIR_SEP "{:016X}_{:02X}.bin",
+                    Common::FS::GetUserPath(Common::FS::UserPath::CacheDir), title_id,
+                    static_cast<u8>(type));
+    auto packed = CreateRomFS(std::move(layered), std::move(layered_ext), metadata_cache_path);
     if (packed == nullptr) {
         return;
     }
@@ -3,13 +3,18 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <cstring>
 #include <random>
 #include <regex>
+#include <thread>
 #include <mbedtls/sha256.h>
 #include "common/assert.h"
+#include "common/cityhash.h"
+#include "common/common_paths.h"
 #include "common/file_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
+#include "common/thread_worker.h"
 #include "core/crypto/key_manager.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/content_archive.h"
@@ -17,6 +22,7 @@
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/submission_package.h"
 #include "core/file_sys/vfs_concat.h"
+#include "core/file_sys/vfs_vector.h"
 #include "core/loader/loader.h"
 
 namespace FileSys {
@@ -24,6 +30,21 @@ namespace FileSys {
 // The size of blocks to use when vfs raw copying into nand.
 constexpr size_t VFS_RC_LARGE_COPY_BLOCK = 0x400000;
 
+constexpr u32 CONTENT_INDEX_MAGIC = Common::MakeMagic('Y', 'C', 'I', 'X');
+constexpr u32 CONTENT_INDEX_VERSION = 1;
+
+/// Result of parsing an NCA, persisted in the content index of its registered cache
+struct ContentIndexEntry {
+    /// Size of the NCA file when it was parsed, a mismatch forces it to be parsed again
+    u64 size = 0;
+    /// Title ID of the meta NCA, unused when cnmt is empty
+    u64 title_id = 0;
+    /// Raw CNMT of a meta NCA, empty for any other content
+    std::vector<u8> cnmt;
+};
+
+using ContentIndex = std::map<NcaID, ContentIndexEntry>;
+
 std::string ContentProviderEntry::DebugInfo() const {
     return fmt::format("title_id={:016X}, content_type={:02X}", title_id, static_cast<u8>(type));
 }
@@ -404,28 +425,187 @@ std::vector<NcaID> RegisteredCache::AccumulateFiles() const {
     return ids;
 }
 
-void RegisteredCache::ProcessFiles(const std::vector<NcaID>& ids) {
-    for (const auto& id : ids) {
-        const auto file = GetFileAtID(id);
+static ContentIndex LoadContentIndex(const std::string& path) {
+    Common::FS::IOFile file(path, "rb");
+    if (!file.IsOpen()) {
+        return {};
+    }
+    std::vector<u8> data(file.GetSize());
+    if (file.ReadBytes(data.data(), data.size()) != data.size()) {
+        return {};
+    }
+
+    std::size_t offset = 0;
+    const auto read = [&data, &offset](void* dest, std::size_t size) {
+        if (data.size() - offset < size) {
+            return false;
+        }
+        std::memcpy(dest, data.data() + offset, size);
+        offset += size;
+        return true;
+    };
+
+    u32 magic{};
+    u32 version{};
+    u64 checksum{};
+    if (!read(&magic, sizeof(magic)) || !read(&version, sizeof(version)) ||
+        !read(&checksum, sizeof(checksum)) || magic != CONTENT_INDEX_MAGIC ||
+        version != CONTENT_INDEX_VERSION ||
+        checksum != Common::CityHash64(reinterpret_cast<const char*>(data.data() + offset),
+                                       data.size() - offset)) {
+        LOG_WARNING(Loader, "Ignoring invalid content index at path={}", path);
+        return {};
+    }
+
+    ContentIndex index;
+    u32 num_entries{};
+    if (!read(&num_entries, sizeof(num_entries))) {
+        return {};
+    }
+    for (u32 i = 0; i < num_entries; ++i) {
+        NcaID id{};
+        ContentIndexEntry entry;
+        u32 cnmt_size{};
+        if (!read(id.data(), id.size()) || !read(&entry.size, sizeof(entry.size)) ||
+            !read(&entry.title_id, sizeof(entry.title_id)) ||
+            !read(&cnmt_size, sizeof(cnmt_size))) {
+            return {};
+        }
+        entry.cnmt.resize(cnmt_size);
+        if (!read(entry.cnmt.data(), cnmt_size)) {
+            return {};
+        }
+        index.insert_or_assign(id, std::move(entry));
+    }
+    return index;
+}
+
+static void SaveContentIndex(const std::string& path, const ContentIndex& index) {
+    std::vector<u8> payload;
+    const auto write = [&payload](const void* src, std::size_t size) {
+        const auto* const bytes = static_cast<const u8*>(src);
+        payload.insert(payload.end(), bytes, bytes + size);
+    };
+
+    const auto num_entries = static_cast<u32>(index.size());
+    write(&num_entries, sizeof(num_entries));
+    for (const auto& [id, entry] : index) {
+        const auto cnmt_size = static_cast<u32>(entry.cnmt.size());
+        write(id.data(), id.size());
+        write(&entry.size, sizeof(entry.size));
+        write(&entry.title_id, sizeof(entry.title_id));
+        write(&cnmt_size, sizeof(cnmt_size));
+        write(entry.cnmt.data(), entry.cnmt.size());
+    }
+    const u64 checksum =
+        Common::CityHash64(reinterpret_cast<const char*>(payload.data()), payload.size());
+
+    if (!Common::FS::CreateFullPath(path)) {
+        LOG_ERROR(Loader, "Failed to create the directory of path={}", path);
+        return;
+    }
+    Common::FS::IOFile file(path, "wb");
+    if (!file.IsOpen() || file.WriteObject(CONTENT_INDEX_MAGIC) != 1 ||
+        file.WriteObject(CONTENT_INDEX_VERSION) != 1 || file.WriteObject(checksum) != 1 ||
+        file.WriteBytes(payload.data(), payload.size()) != payload.size()) {
+        LOG_ERROR(Loader, "Failed to write content index to path={}", path);
+    }
+}
 
+/// Parses an NCA, returns std::nullopt when it could not be decrypted so that it is retried
+static std::optional<ContentIndexEntry> ParseContentIndexEntry(VirtualFile file, u64 size) {
+    const NCA nca(std::move(file), nullptr, 0);
+    if (nca.GetStatus() != Loader::ResultStatus::Success) {
+        return std::nullopt;
+    }
+
+    ContentIndexEntry entry{.size = size};
+    if (nca.GetType() != NCAContentType::Meta) {
+        return entry;
+    }
+
+    const auto section0 = nca.GetSubdirectories()[0];
+    for (const auto& section0_file : section0->GetFiles()) {
+        if (section0_file->GetExtension() != "cnmt")
+            continue;
+
+        entry.title_id = nca.GetTitleId();
+        entry.cnmt = section0_file->ReadAllBytes();
+        break;
+    }
+    return entry;
+}
+
+std::string RegisteredCache::GetContentIndexPath() const {
+    const std::string full_path = dir->GetFullPath();
+    if (full_path.empty()) {
+        return {};
+    }
+    const u64 path_hash = Common::CityHash64(full_path.data(), full_path.size());
+    return fmt::format("{}content_index" DIR_SEP "{:016X}.bin",
+                       Common::FS::GetUserPath(Common::FS::UserPath::CacheDir), path_hash);
+}
+
+void RegisteredCache::ProcessFiles(const std::vector<NcaID>& ids) {
+    const std::string index_path = GetContentIndexPath();
+    const ContentIndex old_index =
+        index_path.empty() ? ContentIndex{} : LoadContentIndex(index_path);
+
+    // Unchanged content is taken from the index, the remaining NCAs are parsed in parallel
+    std::vector<std::optional<ContentIndexEntry>> entries(ids.size());
+    std::vector<std::pair<std::size_t, VirtualFile>> pending;
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        auto file = GetFileAtID(ids[i]);
         if (file == nullptr)
             continue;
-        const auto nca = std::make_shared<NCA>(parser(file, id), nullptr, 0);
-        if (nca->GetStatus() != Loader::ResultStatus::Success ||
-            nca->GetType() != NCAContentType::Meta) {
+
+        const u64 size = file->GetSize();
+        const auto it = old_index.find(ids[i]);
+        if (it != old_index.end() && it->second.size == size) {
+            entries[i] = it->second;
             continue;
         }
+        pending.emplace_back(i, std::move(file));
+    }
 
-        const auto section0 = nca->GetSubdirectories()[0];
-
-        for (const auto& section0_file : section0->GetFiles()) {
-            if (section0_file->GetExtension() != "cnmt")
-                continue;
+    if (!pending.empty()) {
+        // Derive the SD seed before parsing NAX0 files concurrently, otherwise every parse would
+        // try to store it
+        keys.DeriveSDSeedLazy();
+
+        const auto parse = [this, &ids, &entries](std::size_t i, const VirtualFile& file) {
+            const u64 size = file->GetSize();
+            entries[i] = ParseContentIndexEntry(parser(file, ids[i]), size);
+        };
+        if (pending.size() == 1) {
+            parse(pending.front().first, pending.front().second);
+        } else {
+            const std::size_t num_workers =
+                std::min<std::size_t>(pending.size(), std::thread::hardware_concurrency());
+            Common::ThreadWorker workers(num_workers, "yuzu:ContentIndex");
+            for (const auto& [i, file] : pending) {
+                workers.QueueWork([&parse, i = i, &file = file] { parse(i, file); });
+            }
+            workers.WaitForRequests();
+        }
+    }
 
-            meta.insert_or_assign(nca->GetTitleId(), CNMT(section0_file));
-            meta_id.insert_or_assign(nca->GetTitleId(), id);
-            break;
+    ContentIndex new_index;
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        if (!entries[i]) {
+            continue;
         }
+        const auto& entry = *entries[i];
+        if (!entry.cnmt.empty()) {
+            meta.insert_or_assign(entry.title_id,
+                                  CNMT(std::make_shared<VectorVfsFile>(entry.cnmt)));
+            meta_id.insert_or_assign(entry.title_id, ids[i]);
+        }
+        new_index.insert_or_assign(ids[i], std::move(*entries[i]));
+    }
+
+    if (!index_path.empty() && (!pending.empty() || new_index.size() != old_index.size())) {
+        SaveContentIndex(index_path, new_index);
     }
 }
 
@@ -136,12 +136,13 @@ VirtualDir ExtractRomFS(VirtualFile file, RomFSExtractionType type) {
     return out;
 }
 
-VirtualFile CreateRomFS(VirtualDir dir, VirtualDir ext) {
+VirtualFile CreateRomFS(VirtualDir dir, VirtualDir ext, const std::string& metadata_cache_path) {
     if (dir == nullptr)
         return nullptr;
 
     RomFSBuildContext ctx{dir, ext};
-    return ConcatenatedVfsFile::MakeConcatenatedFile(0, ctx.Build(), dir->GetName());
+    return ConcatenatedVfsFile::MakeConcatenatedFile(0, ctx.Build(metadata_cache_path),
+                                                     dir->GetName());
 }
 
 } // namespace FileSys
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "core/file_sys/vfs.h"
 
 namespace FileSys {
@@ -20,7 +22,9 @@ VirtualDir ExtractRomFS(VirtualFile file,
                         RomFSExtractionType type = RomFSExtractionType::Truncated);
 
 // Converts a VFS filesystem into a RomFS binary
+// The metadata tables are cached at metadata_cache_path when it is not empty
 // Returns nullptr on failure
-VirtualFile CreateRomFS(VirtualDir dir, VirtualDir ext = nullptr);
+VirtualFile CreateRomFS(VirtualDir dir, VirtualDir ext = nullptr,
+                        const std::string& metadata_cache_path = {});
 
 } // namespace FileSys
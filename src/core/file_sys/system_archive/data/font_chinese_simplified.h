@@ -8,6 +8,7 @@
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-extern const std::array<unsigned char, 217276> FONT_CHINESE_SIMPLIFIED;
+/// Zstandard compressed TTF data
+extern const std::array<unsigned char, 73544> FONT_CHINESE_SIMPLIFIED;
 
 } // namespace FileSys::SystemArchive::SharedFontData
@@ -8,6 +8,7 @@
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-extern const std::array<unsigned char, 222236> FONT_CHINESE_TRADITIONAL;
+/// Zstandard compressed TTF data
+extern const std::array<unsigned char, 75017> FONT_CHINESE_TRADITIONAL;
 
 } // namespace FileSys::SystemArchive::SharedFontData
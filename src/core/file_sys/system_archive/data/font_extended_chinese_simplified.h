@@ -8,6 +8,7 @@
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-extern const std::array<unsigned char, 293516> FONT_EXTENDED_CHINESE_SIMPLIFIED;
+/// Zstandard compressed TTF data
+extern const std::array<unsigned char, 109896> FONT_EXTENDED_CHINESE_SIMPLIFIED;
 
 } // namespace FileSys::SystemArchive::SharedFontData
@@ -6,191 +6,120 @@
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-const std::array<unsigned char, 2932> FONT_NINTENDO_EXTENDED{{
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x80, 0x00, 0x03, 0x00, 0x70, 0x44, 0x53, 0x49, 0x47,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0b, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x4f, 0x53, 0x2f, 0x32,
-    0x33, 0x86, 0x1d, 0x9b, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
-    0xc2, 0x06, 0x20, 0xde, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x63, 0x76, 0x74, 0x20,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2c, 0x00, 0x00, 0x00, 0x06, 0x66, 0x70, 0x67, 0x6d,
-    0x06, 0x59, 0x9c, 0x37, 0x00, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x01, 0x73, 0x67, 0x61, 0x73, 0x70,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0b, 0x64, 0x00, 0x00, 0x00, 0x08, 0x67, 0x6c, 0x79, 0x66,
-    0x10, 0x31, 0x88, 0x00, 0x00, 0x00, 0x04, 0x34, 0x00, 0x00, 0x04, 0x64, 0x68, 0x65, 0x61, 0x64,
-    0x15, 0x9d, 0xef, 0x91, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
-    0x09, 0x60, 0x03, 0x71, 0x00, 0x00, 0x01, 0x34, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
-    0x0d, 0x2e, 0x03, 0xa7, 0x00, 0x00, 0x01, 0xd8, 0x00, 0x00, 0x00, 0x26, 0x6c, 0x6f, 0x63, 0x61,
-    0x05, 0xc0, 0x04, 0x6c, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0x00, 0x1e, 0x6d, 0x61, 0x78, 0x70,
-    0x02, 0x1c, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x58, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
-    0x7c, 0xe0, 0x84, 0x5c, 0x00, 0x00, 0x08, 0xb8, 0x00, 0x00, 0x02, 0x09, 0x70, 0x6f, 0x73, 0x74,
-    0x47, 0x4e, 0x74, 0x19, 0x00, 0x00, 0x0a, 0xc4, 0x00, 0x00, 0x00, 0x9e, 0x70, 0x72, 0x65, 0x70,
-    0x1c, 0xfc, 0x7d, 0x9c, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x7c, 0xc7, 0xb1, 0x63, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x1b, 0x03, 0xe8,
-    0x00, 0x00, 0x00, 0x00, 0xd9, 0x44, 0x2f, 0x5d, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x45, 0x7b, 0x69,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xe6, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x84, 0xff, 0x83, 0x01, 0xf4, 0x03, 0xe8,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xe6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x5e,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x74, 0x01, 0x90, 0x00, 0x05,
-    0x00, 0x04, 0x00, 0xcd, 0x00, 0xcd, 0x00, 0x00, 0x01, 0x1f, 0x00, 0xcd, 0x00, 0xcd, 0x00, 0x00,
-    0x03, 0xc3, 0x00, 0x66, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0xc0, 0x00, 0x00, 0xe0, 0xe9, 0x03, 0x84, 0xff, 0x83,
-    0x01, 0xf4, 0x02, 0xee, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe8,
-    0x02, 0xbc, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xfa, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x03, 0xe8, 0x00, 0xeb, 0x01, 0x21, 0x00, 0xff,
-    0x00, 0xff, 0x01, 0x3d, 0x01, 0x17, 0x00, 0x42, 0x00, 0x1c, 0x00, 0x3e, 0x00, 0x17, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x68, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x68, 0x00, 0x06, 0x00, 0x4c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0a,
-    0x00, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x20, 0xe0, 0xe9, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x20, 0xe0, 0xe0, 0xff, 0xff, 0x00, 0x01, 0xff, 0xf5,
-    0xff, 0xe3, 0x1f, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xb8, 0x00, 0x00, 0x2c, 0x4b, 0xb8, 0x00, 0x09, 0x50, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59, 0xb8,
-    0x01, 0xff, 0x85, 0xb8, 0x00, 0x44, 0x1d, 0xb9, 0x00, 0x09, 0x00, 0x03, 0x5f, 0x5e, 0x2d, 0xb8,
-    0x00, 0x01, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x02, 0x2c,
-    0xb8, 0x00, 0x01, 0x2a, 0x21, 0x2d, 0xb8, 0x00, 0x03, 0x2c, 0x20, 0x46, 0xb0, 0x03, 0x25, 0x46,
-    0x52, 0x58, 0x23, 0x59, 0x20, 0x8a, 0x20, 0x8a, 0x49, 0x64, 0x8a, 0x20, 0x46, 0x20, 0x68, 0x61,
-    0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x68, 0x61, 0x64, 0x52, 0x58, 0x23, 0x65, 0x8a, 0x59, 0x2f,
-    0x20, 0xb0, 0x00, 0x53, 0x58, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b,
-    0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x65, 0x59, 0x59, 0x3a, 0x2d, 0xb8, 0x00,
-    0x04, 0x2c, 0x20, 0x46, 0xb0, 0x04, 0x25, 0x46, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x20, 0x46, 0x20,
-    0x6a, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x6a, 0x61, 0x64, 0x52, 0x58, 0x23, 0x8a, 0x59,
-    0x2f, 0xfd, 0x2d, 0xb8, 0x00, 0x05, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x50, 0x58, 0x51, 0x58,
-    0xb0, 0x80, 0x44, 0x1b, 0xb0, 0x40, 0x44, 0x59, 0x1b, 0x21, 0x21, 0x20, 0x45, 0xb0, 0xc0, 0x50,
-    0x58, 0xb0, 0xc0, 0x44, 0x1b, 0x21, 0x59, 0x59, 0x2d, 0xb8, 0x00, 0x06, 0x2c, 0x20, 0x20, 0x45,
-    0x69, 0x44, 0xb0, 0x01, 0x60, 0x20, 0x20, 0x45, 0x7d, 0x69, 0x18, 0x44, 0xb0, 0x01, 0x60, 0x2d,
-    0xb8, 0x00, 0x07, 0x2c, 0xb8, 0x00, 0x06, 0x2a, 0x2d, 0xb8, 0x00, 0x08, 0x2c, 0x4b, 0x20, 0xb0,
-    0x03, 0x26, 0x53, 0x58, 0xb0, 0x40, 0x1b, 0xb0, 0x00, 0x59, 0x8a, 0x8a, 0x20, 0xb0, 0x03, 0x26,
-    0x53, 0x58, 0x23, 0x21, 0xb0, 0x80, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26,
-    0x53, 0x58, 0x23, 0x21, 0xb8, 0x00, 0xc0, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03,
-    0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x00, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0,
-    0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x40, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20,
-    0xb8, 0x00, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x03, 0x25, 0x45, 0xb8, 0x01, 0x80, 0x50, 0x58, 0x23,
-    0x21, 0xb8, 0x01, 0x80, 0x23, 0x21, 0x1b, 0xb0, 0x03, 0x25, 0x45, 0x23, 0x21, 0x23, 0x21, 0x59,
-    0x1b, 0x21, 0x59, 0x44, 0x2d, 0xb8, 0x00, 0x09, 0x2c, 0x4b, 0x53, 0x58, 0x45, 0x44, 0x1b, 0x21,
-    0x21, 0x59, 0x2d, 0x00, 0xb8, 0x00, 0x00, 0x2b, 0x00, 0xba, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07,
-    0x2b, 0xb8, 0x00, 0x00, 0x20, 0x45, 0x7d, 0x69, 0x18, 0x44, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe6, 0x03, 0xe8, 0x00, 0x06,
-    0x00, 0x00, 0x35, 0x01, 0x33, 0x15, 0x01, 0x23, 0x35, 0x03, 0x52, 0x94, 0xfc, 0xa6, 0x8c, 0x90,
-    0x03, 0x58, 0x86, 0xfc, 0xa0, 0x8e, 0x00, 0x00, 0x00, 0x02, 0x00, 0xeb, 0x00, 0xcc, 0x02, 0xfb,
-    0x03, 0x1e, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x33, 0x13, 0x23, 0x27, 0x23, 0x07, 0x23,
-    0x13, 0x17, 0x07, 0x06, 0x15, 0x33, 0x27, 0x07, 0x01, 0xbc, 0x6d, 0xd2, 0x7c, 0x26, 0xcc, 0x26,
-    0x7c, 0xd1, 0x35, 0x40, 0x02, 0x89, 0x45, 0x02, 0x03, 0x1e, 0xfd, 0xae, 0x77, 0x77, 0x02, 0x52,
-    0x9b, 0xcc, 0x08, 0x04, 0xda, 0x02, 0x00, 0x00, 0x00, 0x03, 0x01, 0x21, 0x00, 0xcc, 0x02, 0xc5,
-    0x03, 0x1e, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x00, 0x25, 0x11, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x14, 0x0e, 0x02, 0x07, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x2b, 0x01, 0x13, 0x33, 0x32,
-    0x36, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x1d, 0x01, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x2b,
-    0x01, 0x15, 0x01, 0x21, 0xea, 0x25, 0x3f, 0x2e, 0x1a, 0x0e, 0x15, 0x1b, 0x0e, 0x2d, 0x2d, 0x1a,
-    0x2e, 0x3f, 0x25, 0xf8, 0x76, 0x62, 0x20, 0x2a, 0x28, 0x22, 0x62, 0x76, 0x10, 0x18, 0x11, 0x09,
-    0x22, 0x22, 0x74, 0xcc, 0x02, 0x52, 0x18, 0x2b, 0x3c, 0x24, 0x1d, 0x1f, 0x17, 0x17, 0x14, 0x0f,
-    0x48, 0x2f, 0x24, 0x3f, 0x2e, 0x1a, 0x01, 0x5b, 0x29, 0x20, 0x20, 0x2b, 0x94, 0xf8, 0x0e, 0x16,
-    0x1c, 0x0e, 0x1f, 0x31, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0x00, 0xcc, 0x02, 0xe7,
-    0x03, 0x1e, 0x00, 0x0c, 0x00, 0x00, 0x01, 0x33, 0x17, 0x37, 0x33, 0x03, 0x13, 0x23, 0x27, 0x07,
-    0x23, 0x13, 0x03, 0x01, 0x04, 0x86, 0x69, 0x69, 0x86, 0xa3, 0xa8, 0x88, 0x6c, 0x6c, 0x88, 0xa8,
-    0xa3, 0x03, 0x1e, 0xcb, 0xcb, 0xfe, 0xda, 0xfe, 0xd4, 0xcf, 0xcf, 0x01, 0x2c, 0x01, 0x26, 0x00,
-    0x00, 0x01, 0x00, 0xff, 0x00, 0xcc, 0x02, 0xe7, 0x03, 0x1e, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x03,
-    0x33, 0x17, 0x32, 0x15, 0x1e, 0x01, 0x15, 0x1b, 0x01, 0x33, 0x03, 0x15, 0x23, 0x35, 0x01, 0xb8,
-    0xb9, 0x7e, 0x01, 0x01, 0x01, 0x03, 0x70, 0x75, 0x7f, 0xb9, 0x76, 0x01, 0xa3, 0x01, 0x7b, 0x01,
-    0x01, 0x01, 0x05, 0x02, 0xff, 0x00, 0x01, 0x0a, 0xfe, 0x85, 0xd7, 0xd7, 0x00, 0x01, 0x01, 0x3d,
-    0x00, 0xcc, 0x02, 0xa9, 0x03, 0x1e, 0x00, 0x06, 0x00, 0x00, 0x25, 0x11, 0x33, 0x11, 0x33, 0x15,
-    0x21, 0x01, 0x3d, 0x75, 0xf7, 0xfe, 0x94, 0xcc, 0x02, 0x52, 0xfe, 0x10, 0x62, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x01, 0x17, 0x00, 0xbc, 0x02, 0xcf, 0x03, 0x0e, 0x00, 0x15, 0x00, 0x21, 0x00, 0x00,
-    0x25, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x1d, 0x01, 0x0e, 0x03, 0x1d, 0x01, 0x17, 0x15, 0x23, 0x27,
-    0x23, 0x15, 0x23, 0x13, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x15, 0x01, 0x17,
-    0xf4, 0x27, 0x40, 0x2e, 0x19, 0x01, 0x1f, 0x24, 0x1e, 0x78, 0x7d, 0x6a, 0x5c, 0x75, 0x76, 0x72,
-    0x12, 0x19, 0x11, 0x08, 0x26, 0x26, 0x6a, 0xbc, 0x02, 0x52, 0x1d, 0x31, 0x42, 0x25, 0x16, 0x18,
-    0x32, 0x2a, 0x1b, 0x02, 0x01, 0xef, 0x06, 0xd7, 0xd7, 0x01, 0x3f, 0x10, 0x1a, 0x1e, 0x0f, 0x23,
-    0x36, 0xb0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x42, 0x00, 0xbc, 0x03, 0xa4, 0x03, 0x0e, 0x00, 0x0a,
-    0x00, 0x11, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x01, 0x21, 0x15, 0x21, 0x35, 0x01, 0x21, 0x01,
-    0x11, 0x33, 0x11, 0x33, 0x15, 0x21, 0x42, 0x01, 0xa7, 0xfe, 0xeb, 0x01, 0x1b, 0xfe, 0x53, 0x01,
-    0x15, 0xfe, 0xeb, 0x01, 0xf7, 0x75, 0xf6, 0xfe, 0x95, 0x02, 0xac, 0x62, 0x45, 0xfe, 0x55, 0x62,
-    0x47, 0x01, 0xa9, 0xfe, 0x10, 0x02, 0x52, 0xfe, 0x10, 0x62, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1c,
-    0x00, 0xbc, 0x03, 0xca, 0x03, 0x0e, 0x00, 0x0a, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35,
-    0x21, 0x15, 0x01, 0x21, 0x15, 0x21, 0x35, 0x01, 0x21, 0x01, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x06, 0x07, 0x0e, 0x03, 0x15, 0x17, 0x15, 0x23, 0x27, 0x23, 0x15, 0x23, 0x13, 0x33, 0x32,
-    0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x2b, 0x01, 0x15, 0x1c, 0x01, 0xa7, 0xfe, 0xeb, 0x01, 0x1b,
-    0xfe, 0x53, 0x01, 0x15, 0xfe, 0xeb, 0x01, 0xf7, 0xf3, 0x27, 0x41, 0x2d, 0x19, 0x1c, 0x20, 0x01,
-    0x0d, 0x0e, 0x0a, 0x78, 0x7d, 0x69, 0x5c, 0x75, 0x76, 0x71, 0x11, 0x1a, 0x12, 0x09, 0x0a, 0x14,
-    0x1d, 0x13, 0x69, 0x02, 0xac, 0x62, 0x45, 0xfe, 0x55, 0x62, 0x47, 0x01, 0xa9, 0xfe, 0x10, 0x02,
-    0x52, 0x1d, 0x31, 0x42, 0x25, 0x2b, 0x44, 0x1d, 0x01, 0x08, 0x09, 0x07, 0x01, 0xf1, 0x06, 0xd7,
-    0xd7, 0x01, 0x3f, 0x11, 0x19, 0x1f, 0x0e, 0x11, 0x20, 0x19, 0x0f, 0xb0, 0x00, 0x02, 0x00, 0x3e,
-    0x00, 0xb3, 0x03, 0xa8, 0x03, 0x17, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x00, 0x13, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x27, 0x34, 0x27, 0x2e, 0x01, 0x23, 0x22, 0x0e, 0x02, 0x15,
-    0x14, 0x16, 0x15, 0x1e, 0x05, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x1e,
-    0x01, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x04, 0x35, 0x01, 0x11, 0x33, 0x11, 0x33, 0x15,
-    0x21, 0x50, 0x24, 0x3b, 0x4a, 0x27, 0x28, 0x4b, 0x39, 0x22, 0x73, 0x01, 0x01, 0x08, 0x2b, 0x29,
-    0x10, 0x20, 0x19, 0x0f, 0x01, 0x0b, 0x35, 0x41, 0x46, 0x3b, 0x25, 0x23, 0x3a, 0x4b, 0x27, 0x2b,
-    0x50, 0x3f, 0x26, 0x74, 0x05, 0x34, 0x33, 0x10, 0x20, 0x1a, 0x11, 0x2c, 0x42, 0x4d, 0x42, 0x2c,
-    0x01, 0xef, 0x73, 0xf6, 0xfe, 0x97, 0x02, 0x70, 0x2a, 0x3f, 0x2a, 0x14, 0x18, 0x2e, 0x44, 0x2c,
-    0x02, 0x03, 0x01, 0x27, 0x27, 0x07, 0x10, 0x1a, 0x12, 0x02, 0x0b, 0x02, 0x1f, 0x22, 0x19, 0x17,
-    0x27, 0x3f, 0x34, 0x2c, 0x3e, 0x28, 0x13, 0x1a, 0x32, 0x48, 0x2e, 0x30, 0x30, 0x06, 0x0f, 0x1a,
-    0x13, 0x21, 0x27, 0x1e, 0x1b, 0x29, 0x3e, 0x31, 0xfe, 0x4c, 0x02, 0x53, 0xfe, 0x10, 0x63, 0x00,
-    0x00, 0x03, 0x00, 0x17, 0x00, 0xb3, 0x03, 0xce, 0x03, 0x17, 0x00, 0x38, 0x00, 0x4f, 0x00, 0x5d,
-    0x00, 0x00, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x27, 0x34, 0x23, 0x2e,
-    0x01, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x04, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x33, 0x1e, 0x01, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x03, 0x35,
-    0x01, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x30, 0x0e, 0x02, 0x31, 0x17, 0x15,
-    0x23, 0x27, 0x23, 0x15, 0x23, 0x13, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x2b, 0x01,
-    0x15, 0x2a, 0x24, 0x3a, 0x4a, 0x26, 0x29, 0x4b, 0x39, 0x23, 0x73, 0x01, 0x01, 0x08, 0x2a, 0x2a,
-    0x10, 0x1f, 0x1a, 0x10, 0x2c, 0x42, 0x4d, 0x42, 0x2c, 0x23, 0x39, 0x4b, 0x27, 0x2b, 0x51, 0x3f,
-    0x27, 0x75, 0x05, 0x34, 0x33, 0x10, 0x20, 0x1a, 0x10, 0x1f, 0x1c, 0x25, 0x53, 0x47, 0x2e, 0x01,
-    0xed, 0xf3, 0x27, 0x41, 0x2d, 0x19, 0x1c, 0x20, 0x0c, 0x0e, 0x0c, 0x78, 0x7d, 0x68, 0x5d, 0x75,
-    0x76, 0x71, 0x11, 0x1a, 0x12, 0x09, 0x0a, 0x14, 0x1d, 0x13, 0x69, 0x02, 0x71, 0x2a, 0x3e, 0x2a,
-    0x14, 0x18, 0x2e, 0x44, 0x2c, 0x02, 0x02, 0x27, 0x29, 0x07, 0x11, 0x1a, 0x12, 0x1d, 0x24, 0x1c,
-    0x1d, 0x2b, 0x40, 0x32, 0x2c, 0x3f, 0x29, 0x13, 0x1a, 0x31, 0x49, 0x2e, 0x30, 0x30, 0x06, 0x0f,
-    0x19, 0x13, 0x1e, 0x22, 0x0b, 0x0e, 0x20, 0x2f, 0x43, 0x30, 0xfe, 0x4b, 0x02, 0x52, 0x1d, 0x32,
-    0x42, 0x25, 0x2c, 0x42, 0x1d, 0x08, 0x0a, 0x08, 0xf1, 0x06, 0xd7, 0xd7, 0x01, 0x3f, 0x11, 0x19,
-    0x1f, 0x0e, 0x11, 0x20, 0x19, 0x0f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12,
-    0x00, 0x12, 0x00, 0x32, 0x00, 0x72, 0x00, 0x8e, 0x00, 0xac, 0x00, 0xbe, 0x00, 0xf0, 0x01, 0x14,
-    0x01, 0x5c, 0x01, 0xb6, 0x02, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0xa2, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x07, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2f,
-    0x00, 0x17, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x46, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x58, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x12, 0x00, 0x65, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x77, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x97, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x5e, 0x00, 0xa5, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x04, 0x00, 0x24, 0x01, 0x03, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x1a,
-    0x01, 0x27, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x24, 0x01, 0x41, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x11, 0x00, 0x02, 0x01, 0x65, 0x59, 0x75, 0x7a, 0x75, 0x4f, 0x53,
-    0x53, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61,
-    0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x3b, 0x3b,
-    0x59, 0x75, 0x7a, 0x75, 0x4f, 0x53, 0x53, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e,
-    0x2d, 0x52, 0x3b, 0x32, 0x30, 0x31, 0x39, 0x3b, 0x46, 0x4c, 0x56, 0x49, 0x2d, 0x36, 0x31, 0x34,
-    0x59, 0x75, 0x7a, 0x75, 0x4f, 0x53, 0x53, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e,
-    0x20, 0x52, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x59,
-    0x75, 0x7a, 0x75, 0x4f, 0x53, 0x53, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x2d,
-    0x52, 0x00, 0x59, 0x00, 0x75, 0x00, 0x7a, 0x00, 0x75, 0x00, 0x4f, 0x00, 0x53, 0x00, 0x53, 0x00,
-    0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00,
-    0x6e, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00,
-    0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00,
-    0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x59, 0x00,
-    0x75, 0x00, 0x7a, 0x00, 0x75, 0x00, 0x4f, 0x00, 0x53, 0x00, 0x53, 0x00, 0x45, 0x00, 0x78, 0x00,
-    0x74, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x2d, 0x00,
-    0x52, 0x00, 0x3b, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x46, 0x00,
-    0x4c, 0x00, 0x56, 0x00, 0x49, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x31, 0x00, 0x34, 0x00, 0x59, 0x00,
-    0x75, 0x00, 0x7a, 0x00, 0x75, 0x00, 0x4f, 0x00, 0x53, 0x00, 0x53, 0x00, 0x45, 0x00, 0x78, 0x00,
-    0x74, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00,
-    0x52, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00,
-    0x20, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x59, 0x00, 0x75, 0x00,
-    0x7a, 0x00, 0x75, 0x00, 0x4f, 0x00, 0x53, 0x00, 0x53, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00,
-    0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x2d, 0x00, 0x52, 0x00,
-    0x52, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x32,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x01, 0x02, 0x01, 0x03, 0x00, 0x03, 0x01, 0x04,
-    0x01, 0x05, 0x01, 0x06, 0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x0c,
-    0x01, 0x0d, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x30, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
-    0x30, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x45, 0x30, 0x45, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x45, 0x30,
-    0x45, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x45, 0x30, 0x45, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x45, 0x30,
-    0x45, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x45, 0x30, 0x45, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x45, 0x30,
-    0x45, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x45, 0x30, 0x45, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x45, 0x30,
-    0x45, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x45, 0x30, 0x45, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x45, 0x30,
-    0x45, 0x39, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00,
+const std::array<unsigned char, 1801> FONT_NINTENDO_EXTENDED{{
+    0x28, 0xb5, 0x2f, 0xfd, 0x64, 0x74, 0x0a, 0xdd, 0x37, 0x00, 0x8a, 0x62, 0x90, 0x15, 0x49, 0x70,
+    0x9a, 0x99, 0x74, 0xa2, 0xa3, 0x2c, 0x1e, 0x8a, 0x6b, 0xd3, 0xde, 0xfd, 0x6c, 0x08, 0xc8, 0x54,
+    0xcb, 0xcc, 0x36, 0x82, 0x21, 0x26, 0x22, 0x10, 0xc8, 0xbf, 0xec, 0x6d, 0xbc, 0x87, 0xc1, 0x6a,
+    0x8a, 0xad, 0xd9, 0x3c, 0xde, 0xc3, 0xe7, 0x69, 0x21, 0x7d, 0xb9, 0x0c, 0xcd, 0x98, 0x3a, 0x89,
+    0x19, 0x45, 0x51, 0xda, 0x02, 0x43, 0x08, 0x12, 0xc5, 0xd0, 0x00, 0x47, 0xd0, 0x7b, 0x1d, 0x42,
+    0x5e, 0xae, 0x5b, 0x20, 0x44, 0xb6, 0x4c, 0x01, 0x2c, 0x01, 0x50, 0x01, 0x53, 0x01, 0xdd, 0x14,
+    0xdf, 0xee, 0x62, 0x5d, 0x74, 0x13, 0xb9, 0x46, 0xe1, 0xde, 0x85, 0x62, 0xfe, 0x5d, 0x21, 0xa2,
+    0x97, 0x2f, 0x9b, 0x6f, 0x77, 0xf9, 0xbf, 0x5f, 0x31, 0x5d, 0xe2, 0x07, 0xc8, 0xcf, 0xbf, 0x15,
+    0xf8, 0xec, 0xf0, 0x73, 0xf1, 0x77, 0xf0, 0x5a, 0x07, 0xaf, 0xe0, 0xff, 0xbf, 0xef, 0x4a, 0x0f,
+    0xbe, 0xe9, 0xbe, 0x46, 0xd0, 0xdf, 0x7f, 0x5f, 0x6c, 0x32, 0x70, 0xfe, 0x3f, 0xfe, 0x4f, 0x96,
+    0xc3, 0xc0, 0x87, 0x73, 0x33, 0x59, 0x4c, 0x97, 0xbf, 0xec, 0xf1, 0x75, 0xfd, 0xcc, 0xe1, 0x4b,
+    0x60, 0x62, 0x5f, 0xca, 0x67, 0xa7, 0xfd, 0x45, 0x77, 0xc1, 0xb3, 0xe7, 0x5f, 0xe7, 0xf0, 0x33,
+    0x3c, 0x47, 0x7b, 0x7f, 0x4d, 0x9f, 0xf8, 0xa2, 0x80, 0xff, 0xda, 0x17, 0x58, 0x3b, 0x82, 0x8a,
+    0xa1, 0x68, 0xaa, 0xe5, 0xff, 0xc3, 0xc0, 0xc0, 0xb3, 0x39, 0xc0, 0xa3, 0x81, 0x8a, 0x88, 0x13,
+    0x12, 0xff, 0xfb, 0x02, 0xfe, 0xfb, 0xcc, 0x7e, 0x1b, 0x61, 0x72, 0x82, 0xdb, 0xec, 0xd6, 0x16,
+    0x07, 0x13, 0x9d, 0x1f, 0xa8, 0x0b, 0xc2, 0x82, 0x2e, 0x2e, 0x0f, 0x5b, 0x5c, 0xfe, 0xbb, 0x17,
+    0x50, 0x74, 0x21, 0x91, 0xcd, 0x92, 0xd2, 0x8a, 0xaf, 0x1a, 0x1e, 0xcc, 0x5b, 0x30, 0xa9, 0xac,
+    0x21, 0x8d, 0xdb, 0x8f, 0x35, 0x2b, 0xa3, 0x49, 0x51, 0x79, 0xc0, 0x42, 0x66, 0xe9, 0xff, 0x07,
+    0xdc, 0x0c, 0x00, 0xd6, 0x95, 0x75, 0x25, 0xf4, 0xfe, 0x3f, 0xc0, 0x1b, 0x70, 0x57, 0x47, 0x72,
+    0xfe, 0xc3, 0x38, 0x73, 0xa3, 0x57, 0x25, 0x95, 0xbd, 0xaa, 0x32, 0x9a, 0xfd, 0x5f, 0xf1, 0xd4,
+    0x71, 0x08, 0x81, 0x65, 0x55, 0xa5, 0xfb, 0xbf, 0xe5, 0x92, 0xb2, 0xe2, 0xea, 0x3f, 0x47, 0xfe,
+    0x09, 0xd8, 0xc0, 0xd6, 0xb2, 0xac, 0xb6, 0x1c, 0x6a, 0xff, 0x99, 0xb3, 0xfb, 0x3c, 0xee, 0xfa,
+    0xa2, 0xca, 0xf1, 0xfc, 0x73, 0x89, 0x6b, 0x4a, 0xb6, 0x52, 0x59, 0x54, 0x1b, 0xfe, 0x83, 0xf5,
+    0x5f, 0x43, 0xa8, 0x22, 0x0a, 0x2d, 0xb2, 0x46, 0xb8, 0xfd, 0xc7, 0xda, 0xf9, 0xfb, 0xff, 0x82,
+    0x27, 0xeb, 0x74, 0x7b, 0xf8, 0x62, 0xe7, 0xf9, 0xdf, 0x0f, 0xc7, 0xf1, 0x24, 0xe6, 0x82, 0x02,
+    0x72, 0x6f, 0x62, 0x2c, 0xe3, 0x78, 0xc8, 0x42, 0x0b, 0x15, 0x31, 0xe0, 0xf1, 0xf1, 0xf9, 0x88,
+    0x42, 0xa1, 0x03, 0xcb, 0x9f, 0x6a, 0x8e, 0xd2, 0x15, 0x14, 0x84, 0xdb, 0xfd, 0xe8, 0xbe, 0xa6,
+    0x82, 0x06, 0x28, 0xe3, 0xa9, 0xaf, 0x37, 0xc7, 0xa5, 0xe6, 0x8f, 0x88, 0x28, 0x07, 0xec, 0xe5,
+    0x7e, 0xcd, 0xa5, 0xe3, 0x98, 0x62, 0xf7, 0xb2, 0x12, 0x34, 0xda, 0xc2, 0x5e, 0x22, 0x8d, 0xa4,
+    0x47, 0xd0, 0x28, 0xaf, 0x97, 0x3d, 0xb4, 0xe5, 0x9c, 0x4f, 0x2f, 0x0f, 0xa1, 0xd1, 0xdd, 0xf1,
+    0x5f, 0x9e, 0xf8, 0x5e, 0x93, 0x62, 0xc3, 0x79, 0xcb, 0xec, 0x16, 0xa5, 0x46, 0x35, 0x83, 0x00,
+    0x31, 0x64, 0xce, 0x10, 0xce, 0x54, 0x16, 0x99, 0x49, 0x5a, 0x85, 0x04, 0x32, 0x0a, 0x92, 0x84,
+    0x95, 0x2c, 0xb2, 0xb6, 0x25, 0xa3, 0xbd, 0x9a, 0xcd, 0xc7, 0x33, 0xda, 0x8c, 0x49, 0x23, 0x2f,
+    0xda, 0x3f, 0xcf, 0x6f, 0x1f, 0xc2, 0x71, 0x72, 0x94, 0x93, 0x79, 0x76, 0x91, 0x43, 0x8e, 0x8a,
+    0x2b, 0xfc, 0xa2, 0x85, 0x0f, 0x39, 0x31, 0xaa, 0xb0, 0xd4, 0xd8, 0xbd, 0x68, 0x4b, 0xff, 0x5a,
+    0xbe, 0xcf, 0xff, 0xbf, 0xbb, 0xb4, 0xbd, 0xdf, 0x47, 0xf2, 0xe5, 0xdf, 0x3d, 0x11, 0x76, 0x4a,
+    0xbd, 0x5a, 0xa1, 0x98, 0xb8, 0x29, 0xb6, 0x68, 0x2c, 0x1a, 0x81, 0x45, 0xa3, 0x58, 0x94, 0x58,
+    0x77, 0xa9, 0x47, 0xf8, 0x5d, 0xa6, 0x77, 0xd9, 0xbb, 0x58, 0xe3, 0x18, 0x70, 0x6c, 0x4c, 0x8c,
+    0x5b, 0x34, 0x8e, 0x8d, 0x61, 0xcf, 0x05, 0x32, 0x71, 0xaf, 0xd6, 0x9b, 0xb2, 0x66, 0xfb, 0xd1,
+    0x86, 0xd5, 0xb0, 0xd8, 0x22, 0x70, 0x5a, 0xc6, 0xbd, 0x46, 0x95, 0x71, 0xa9, 0x71, 0xb1, 0x08,
+    0xc4, 0x4e, 0x99, 0xb8, 0xc0, 0xa9, 0x18, 0xf7, 0x2a, 0xe1, 0x1a, 0x85, 0x84, 0xb9, 0x31, 0x14,
+    0x93, 0x36, 0xa7, 0x43, 0x07, 0xec, 0xd8, 0x6c, 0x66, 0x00, 0x8b, 0xcd, 0x02, 0xb1, 0x4c, 0xdc,
+    0xe2, 0x75, 0x82, 0xf6, 0x6a, 0x3d, 0x37, 0x2e, 0xc2, 0x8e, 0x65, 0x8f, 0x33, 0x6e, 0x95, 0xd4,
+    0x55, 0xec, 0x14, 0x8f, 0x55, 0x3d, 0x8d, 0xc5, 0x63, 0x31, 0xd6, 0x78, 0xad, 0x3a, 0x1d, 0x61,
+    0xae, 0x53, 0xcc, 0x84, 0x8b, 0x4a, 0x66, 0xde, 0xd0, 0xdc, 0xa9, 0x96, 0x1a, 0xc7, 0xcc, 0x7e,
+    0x97, 0x28, 0x83, 0x06, 0xf8, 0xb8, 0x1f, 0x11, 0x4e, 0x1f, 0x3f, 0x9d, 0x2d, 0x99, 0x6c, 0x38,
+    0x33, 0xa7, 0xcd, 0x1f, 0x1f, 0xe5, 0x92, 0x72, 0x9b, 0x67, 0x78, 0xdb, 0x70, 0x9d, 0x69, 0x66,
+    0xd3, 0x83, 0x26, 0xe6, 0xee, 0x17, 0xeb, 0xa2, 0x46, 0xb4, 0x2e, 0xe4, 0x52, 0xd4, 0x32, 0x09,
+    0x65, 0xc0, 0x78, 0x4c, 0x72, 0x4a, 0x20, 0xdd, 0x69, 0xdd, 0xd0, 0xf2, 0xd6, 0xcd, 0x15, 0x84,
+    0x04, 0x35, 0x20, 0xd9, 0x20, 0x49, 0x28, 0x4a, 0x3a, 0xeb, 0x61, 0x54, 0x9a, 0x9b, 0x41, 0x46,
+    0xda, 0xb0, 0x27, 0x20, 0x17, 0x64, 0xec, 0x66, 0xd2, 0x28, 0x69, 0xcc, 0x4a, 0x46, 0x09, 0x6e,
+    0xe0, 0x3e, 0x18, 0x08, 0x5c, 0xe4, 0x4a, 0x5c, 0x1e, 0xa0, 0x78, 0x97, 0x23, 0x02, 0xed, 0xd2,
+    0xb4, 0x0d, 0x77, 0x6b, 0xe1, 0x74, 0xa9, 0xe5, 0x09, 0x7d, 0x74, 0x70, 0x3d, 0xbf, 0xdd, 0x07,
+    0x6d, 0x18, 0x98, 0x4e, 0x2e, 0x40, 0xc7, 0x41, 0x20, 0xa2, 0x04, 0x49, 0x35, 0xc1, 0xdc, 0xec,
+    0xc1, 0x39, 0x5b, 0xad, 0xe8, 0xc5, 0x27, 0xc1, 0xc3, 0x3a, 0x6f, 0x90, 0x5e, 0x30, 0x45, 0xc1,
+    0x4b, 0x9d, 0x12, 0x92, 0x65, 0x78, 0xdb, 0x78, 0xb9, 0xe9, 0xb5, 0xd5, 0x0b, 0x6c, 0x32, 0xde,
+    0x1f, 0xdd, 0xd4, 0xc5, 0x96, 0x16, 0x7b, 0x45, 0x29, 0xef, 0xdf, 0x5d, 0x87, 0x07, 0x4c, 0xf6,
+    0xa6, 0xe7, 0xff, 0xdc, 0x23, 0x23, 0xcf, 0xf0, 0xa7, 0x5b, 0x6a, 0x2c, 0x58, 0x6a, 0x67, 0x3a,
+    0x03, 0x95, 0xd0, 0x1f, 0x01, 0xc7, 0xa6, 0xa7, 0xb0, 0x9a, 0xc9, 0x3a, 0x20, 0x91, 0xb7, 0x1d,
+    0x50, 0xcf, 0xd6, 0x97, 0xd7, 0x85, 0x0e, 0x61, 0x60, 0x43, 0x21, 0x62, 0x03, 0x35, 0x99, 0x92,
+    0x6b, 0x7c, 0x3c, 0x63, 0xaf, 0xe7, 0x6b, 0x21, 0x9c, 0x6b, 0xe1, 0x8b, 0xef, 0x3d, 0x07, 0x53,
+    0xc9, 0x64, 0xf7, 0x75, 0xfe, 0xff, 0x29, 0x9d, 0x37, 0x86, 0xd7, 0x8d, 0x17, 0x82, 0x2e, 0xf6,
+    0xa2, 0xbb, 0x5a, 0x10, 0x04, 0xdd, 0xc7, 0x82, 0x25, 0x85, 0x57, 0xa7, 0xff, 0xcd, 0xb4, 0x11,
+    0xbd, 0xa3, 0xbf, 0x8e, 0x98, 0xf0, 0xda, 0xc2, 0xdd, 0x5d, 0xe2, 0x48, 0xb7, 0xa5, 0xc6, 0x1e,
+    0x1c, 0x6d, 0x60, 0x0f, 0xea, 0x8b, 0xc2, 0x3c, 0xc8, 0x66, 0x36, 0x15, 0x2a, 0x57, 0xbc, 0x5b,
+    0xbc, 0x50, 0xa0, 0x0c, 0xe1, 0x1d, 0x40, 0x56, 0x60, 0x61, 0xad, 0x00, 0xb2, 0x43, 0x85, 0x56,
+    0xab, 0x62, 0xd6, 0x30, 0x1c, 0x25, 0xe0, 0x03, 0x00, 0xe6, 0xfb, 0xfe, 0x1f, 0x3c, 0xff, 0x7e,
+    0xfb, 0xfd, 0x1f, 0xa9, 0x00, 0x81, 0x23, 0xa9, 0x51, 0x14, 0xfa, 0x74, 0x52, 0x9d, 0xd4, 0xa9,
+    0x53, 0xab, 0xe5, 0x65, 0x0b, 0xd0, 0x00, 0x7a, 0xa7, 0x75, 0x1a, 0xd7, 0xb7, 0xb6, 0x75, 0xad,
+    0x69, 0x3d, 0xeb, 0xdc, 0x7f, 0x0e, 0x7a, 0x1b, 0xdf, 0x6a, 0x6c, 0x74, 0xf4, 0xe4, 0xe0, 0x4e,
+    0x48, 0x7f, 0x42, 0xab, 0x27, 0x4a, 0x72, 0xbe, 0xf9, 0xe7, 0xe3, 0xad, 0x0a, 0xdf, 0xba, 0xd4,
+    0xb1, 0xac, 0xaa, 0x1e, 0xae, 0x3d, 0xd7, 0xb5, 0x9e, 0x7d, 0xd7, 0xc1, 0x4e, 0xb5, 0x3e, 0x82,
+    0x88, 0x7b, 0x1d, 0xfb, 0x6a, 0x6c, 0xf4, 0x3c, 0x22, 0x7a, 0xaa, 0xe0, 0xc0, 0x29, 0x09, 0xe9,
+    0xe9, 0x84, 0x26, 0x55, 0x89, 0x92, 0x92, 0x9c, 0xcf, 0x78, 0x2b, 0x5b, 0x61, 0x4b, 0x0a, 0xcb,
+    0xcb, 0x2a, 0x5b, 0xd5, 0xf2, 0xa0, 0xe5, 0xd2, 0xca, 0x76, 0x81, 0x51, 0xad, 0xd6, 0x08, 0x5e,
+    0x22, 0xbc, 0xb0, 0xd9, 0xce, 0xdf, 0x25, 0xa8, 0x25, 0xfb, 0x77, 0x1a, 0xdc, 0x42, 0x9f, 0xf5,
+    0x78, 0x86, 0xc3, 0x33, 0x9e, 0x7b, 0x06, 0xf1, 0xf8, 0x7d, 0xdc, 0xac, 0x0f, 0x3f, 0x5b, 0xbb,
+    0xd2, 0x9c, 0x66, 0xbe, 0x17, 0x1d, 0xd6, 0xdd, 0xf6, 0xfc, 0xeb, 0xde, 0x7d, 0x1d, 0xd0, 0x6c,
+    0xa4, 0x2f, 0xb4, 0x4f, 0xa3, 0x79, 0x92, 0x0b, 0xb9, 0x8b, 0x6f, 0x1d, 0xda, 0xf3, 0xff, 0xa6,
+    0x73, 0x13, 0x36, 0x31, 0x8f, 0x4d, 0x50, 0x28, 0xaf, 0x53, 0x41, 0x51, 0x9c, 0xdb, 0x09, 0x1a,
+    0xf2, 0x80, 0x9e, 0x9e, 0x3f, 0xde, 0xd0, 0x12, 0x13, 0xca, 0xb4, 0x14, 0x06, 0x85, 0x84, 0x3d,
+    0xbf, 0x9d, 0x6d, 0x28, 0x99, 0x95, 0x94, 0x1f, 0x30, 0x5c, 0x85, 0x81, 0x01, 0xc8, 0x01, 0x28,
+    0xd3, 0xcd, 0x05, 0xd6, 0x63, 0x90, 0xa8, 0xf3, 0x4a, 0x2e, 0x49, 0x40, 0x32, 0xea, 0x7e, 0x44,
+    0x9d, 0x52, 0x69, 0x44, 0x82, 0x1a, 0x42, 0x36, 0x30, 0x20, 0xa4, 0x7c, 0xe6, 0x9c, 0x53, 0x0a,
+    0x37, 0x93, 0xc8, 0xd9, 0xd0, 0x88, 0xe1, 0x11, 0x5e, 0x60, 0x8a, 0xef, 0xf0, 0x4f, 0xa5, 0xf3,
+    0x5a, 0xb3, 0x03, 0xef, 0x53, 0x69, 0x08, 0x38, 0x4c, 0x16, 0x79, 0x3f, 0x9e, 0x9a, 0xd3, 0xd9,
+    0x64, 0x00, 0xfd, 0xf1, 0x06, 0x28, 0x31, 0x8d, 0x96, 0x92, 0x3e, 0xa0, 0x20, 0x62, 0xde, 0xc9,
+    0x3d, 0x01, 0x80, 0xd3, 0xa8, 0x51, 0x38, 0xe6, 0x10, 0x33, 0x88, 0xd0, 0x88, 0x88, 0xc8, 0x68,
+    0x92, 0xa4, 0x03, 0x90, 0x46, 0x88, 0x86, 0x6c, 0x3a, 0x82, 0x43, 0xa0, 0x82, 0xcd, 0x8c, 0x88,
+    0x94, 0x16, 0xa4, 0xa0, 0xa4, 0x50, 0xa7, 0x31, 0xa7, 0xbe, 0x8f, 0xdb, 0x52, 0x27, 0xa3, 0x10,
+    0x3a, 0x92, 0xf8, 0x8c, 0x02, 0xc2, 0xdc, 0x73, 0x39, 0x86, 0xe0, 0xf0, 0x10, 0x51, 0xe1, 0x00,
+    0x5a, 0x51, 0x00, 0x95, 0x36, 0xd0, 0x95, 0x73, 0x55, 0x15, 0xb5, 0x7d, 0xd1, 0x59, 0x72, 0x41,
+    0x3f, 0x0f, 0xac, 0x32, 0xe9, 0xc3, 0x07, 0x35, 0xdc, 0x42, 0xdb, 0x51, 0xc9, 0x94, 0x7b, 0x7a,
+    0x02, 0xd1, 0x4b, 0x14, 0x74, 0x0c, 0x17, 0x2e, 0x39, 0x48, 0x74, 0xc4, 0x47, 0xe5, 0x14, 0xf6,
+    0x6a, 0x85, 0x82, 0x12, 0x7c, 0xdb, 0xc4, 0xfd, 0x3b, 0x84, 0x6d, 0x76, 0x41, 0x9d, 0x14, 0x30,
+    0xd0, 0x05, 0x32, 0x47, 0x59, 0xc9, 0x32, 0xea, 0x4a, 0x1d, 0x58, 0x08, 0x93, 0x2f, 0xa2, 0x6d,
+    0x8e, 0x8b, 0x0d, 0xc1, 0x88, 0xf4, 0x7e, 0x54, 0x36, 0x3c, 0x27, 0x4f, 0xa3, 0x4a, 0xd6, 0x7a,
+    0x97, 0x1a, 0x11, 0xcc, 0xe8, 0xc2, 0x9d, 0x23, 0x7d, 0xc1, 0xdb, 0x53, 0x71, 0x73, 0x7e, 0x75,
+    0x58, 0xac, 0x1e, 0x61, 0x56, 0x27, 0x16, 0x21, 0x82, 0x48, 0x91, 0x7c, 0x0b, 0x26, 0x2d, 0x90,
+    0xed, 0xfb, 0x69, 0x46, 0xd7, 0x3c, 0xf8, 0xd4, 0xb7, 0x67, 0xaf, 0x74, 0x05, 0x9a, 0xac, 0xe9,
+    0xcb, 0x18, 0x0a, 0xd3, 0xe7, 0xf6, 0x0b, 0x06, 0xdf, 0x59, 0x34, 0xf6, 0xc9, 0x53, 0x7d, 0x20,
+    0x88, 0x19, 0x75, 0xcc, 0x40, 0xbf, 0xdd, 0x9a, 0x8b, 0x71, 0x7d, 0xcf, 0x04, 0xe4, 0x32, 0x75,
+    0xac, 0xb7, 0xed, 0x65, 0xb4, 0xa2, 0x8d, 0xc1, 0xec, 0x0a, 0x03, 0x34, 0x09, 0xfc, 0x55, 0x13,
+    0x71, 0x5a, 0x1b, 0x07, 0xd6, 0xb5, 0xab, 0xd5, 0x27, 0xe3, 0xce, 0x6d, 0xe0, 0xc8, 0x37, 0xe6,
+    0x92, 0x0b, 0x9c, 0x1f, 0xac, 0xf5, 0xa3, 0x9e, 0x93, 0x6a, 0x67, 0x3e, 0x08, 0x4d, 0xf0, 0xf6,
+    0x11, 0x7e, 0x01, 0xea, 0x64, 0x24, 0xe1, 0xfe, 0x2d, 0xca, 0xf6, 0xaf, 0x85, 0x0a, 0x4b, 0x07,
+    0x74, 0xf8, 0x54, 0xd9, 0x55, 0x20, 0x1c, 0xb7, 0x2c, 0x3c, 0xdf, 0x2d, 0xce, 0x28, 0x27, 0x57,
+    0x36, 0xd9, 0x7e, 0x52, 0x6e, 0x00, 0xf1, 0x1f, 0x5f, 0x28, 0x8f, 0x9c, 0x47, 0x41, 0x6d, 0xa8,
+    0x5a, 0x87, 0x21, 0xc5, 0x37, 0xe0, 0xf0, 0x52, 0x7a, 0x57, 0xfb, 0x1e, 0x18, 0xaf, 0x43, 0x2b,
+    0x85, 0xca, 0x0f, 0x38, 0xe8, 0xaf, 0x9b, 0x6b, 0x8f, 0x8f, 0x5b, 0x7b, 0x59, 0xf5, 0xc7, 0xbd,
+    0x4c, 0x65, 0xf2, 0xd8, 0x70, 0x5c, 0xf8, 0xf5, 0x9e, 0xeb, 0xff, 0x5a, 0x0d, 0x91, 0x79, 0xb4,
+    0xcf, 0x7e, 0xf8, 0x75, 0x3a, 0xef, 0x1e, 0x9b, 0x71, 0x25, 0xc6, 0x7e, 0xff, 0x23, 0x34, 0xa7,
+    0xa6, 0x1b, 0xb1, 0xe7, 0xd4, 0x97, 0x06, 0x42, 0x54,
 }};
 
 } // namespace FileSys::SystemArchive::SharedFontData
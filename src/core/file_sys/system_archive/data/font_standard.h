@@ -8,6 +8,7 @@
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-extern const std::array<unsigned char, 217276> FONT_STANDARD;
+/// Zstandard compressed TTF data
+extern const std::array<unsigned char, 73544> FONT_STANDARD;
 
 } // namespace FileSys::SystemArchive::SharedFontData
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include "common/zstd_compression.h"
 #include "core/file_sys/system_archive/data/font_chinese_simplified.h"
 #include "core/file_sys/system_archive/data/font_chinese_traditional.h"
 #include "core/file_sys/system_archive/data/font_extended_chinese_simplified.h"
@@ -18,10 +19,11 @@ namespace {
 
 template <std::size_t Size>
 VirtualFile PackBFTTF(const std::array<u8, Size>& data, const std::string& name) {
-    std::vector<u32> vec(Size / sizeof(u32));
-    std::memcpy(vec.data(), data.data(), vec.size() * sizeof(u32));
+    const std::vector<u8> font = Common::Compression::DecompressDataZSTD(data.data(), Size);
+    std::vector<u32> vec(font.size() / sizeof(u32));
+    std::memcpy(vec.data(), font.data(), vec.size() * sizeof(u32));
 
-    std::vector<u8> bfttf(Size + sizeof(u64));
+    std::vector<u8> bfttf(vec.size() * sizeof(u32) + sizeof(u64));
 
     size_t offset = 0;
     Service::NS::EncryptSharedFont(vec, bfttf, offset);
@@ -25,16 +25,27 @@ static bool VerifyConcatenationMapContinuity(const std::multimap<u64, VirtualFil
 
 ConcatenatedVfsFile::ConcatenatedVfsFile(std::vector<VirtualFile> files_, std::string name)
     : name(std::move(name)) {
-    std::size_t next_offset = 0;
-    for (const auto& file : files_) {
-        files.emplace(next_offset, file);
-        next_offset += file->GetSize();
+    files.reserve(files_.size());
+    u64 next_offset = 0;
+    for (auto& file : files_) {
+        const u64 size = file->GetSize();
+        if (size != 0) {
+            files.push_back({next_offset, size, std::move(file)});
+        }
+        next_offset += size;
     }
 }
 
 ConcatenatedVfsFile::ConcatenatedVfsFile(std::multimap<u64, VirtualFile> files_, std::string name)
-    : files(std::move(files_)), name(std::move(name)) {
-    ASSERT(VerifyConcatenationMapContinuity(files));
+    : name(std::move(name)) {
+    ASSERT(VerifyConcatenationMapContinuity(files_));
+    files.reserve(files_.size());
+    for (auto& [offset, file] : files_) {
+        const u64 size = file->GetSize();
+        if (size != 0) {
+            files.push_back({offset, size, std::move(file)});
+        }
+    }
 }
 
 ConcatenatedVfsFile::~ConcatenatedVfsFile() = default;
@@ -79,13 +90,13 @@ std::string ConcatenatedVfsFile::GetName() const {
         return "";
     if (!name.empty())
         return name;
-    return files.begin()->second->GetName();
+    return files.front().file->GetName();
 }
 
 std::size_t ConcatenatedVfsFile::GetSize() const {
     if (files.empty())
         return 0;
-    return files.rbegin()->first + files.rbegin()->second->GetSize();
+    return files.back().offset + files.back().size;
 }
 
 bool ConcatenatedVfsFile::Resize(std::size_t new_size) {
@@ -95,7 +106,7 @@ bool ConcatenatedVfsFile::Resize(std::size_t new_size) {
 std::shared_ptr<VfsDirectory> ConcatenatedVfsFile::GetContainingDirectory() const {
     if (files.empty())
         return nullptr;
-    return files.begin()->second->GetContainingDirectory();
+    return files.front().file->GetContainingDirectory();
 }
 
 bool ConcatenatedVfsFile::IsWritable() const {
@@ -106,26 +117,49 @@ bool ConcatenatedVfsFile::IsReadable() const {
     return true;
 }
 
-std::size_t ConcatenatedVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
-    auto entry = --files.end();
-    for (auto iter = files.begin(); iter != files.end(); ++iter) {
-        if (iter->first > offset) {
-            entry = --iter;
-            break;
+std::size_t ConcatenatedVfsFile::FindEntry(u64 offset) const {
+    const auto contains = [this, offset](std::size_t index) {
+        return files[index].offset <= offset && offset < files[index].offset + files[index].size;
+    };
+    const std::size_t last = last_entry.load(std::memory_order_relaxed);
+    if (last < files.size()) {
+        if (contains(last)) {
+            return last;
+        }
+        if (last + 1 < files.size() && contains(last + 1)) {
+            return last + 1;
         }
     }
+    const auto it = std::upper_bound(
+        files.begin(), files.end(), offset,
+        [](u64 value, const ConcatenationEntry& entry) { return value < entry.offset; });
+    return static_cast<std::size_t>(std::distance(files.begin(), it)) - 1;
+}
 
-    if (entry->first + entry->second->GetSize() <= offset)
+std::size_t ConcatenatedVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    const std::size_t size = GetSize();
+    if (offset >= size) {
         return 0;
-
-    const auto read_in =
-        std::min<u64>(entry->first + entry->second->GetSize() - offset, entry->second->GetSize());
-    if (length > read_in) {
-        return entry->second->Read(data, read_in, offset - entry->first) +
-               Read(data + read_in, length - read_in, offset + read_in);
     }
-
-    return entry->second->Read(data, std::min<u64>(read_in, length), offset - entry->first);
+    length = std::min<std::size_t>(length, size - offset);
+
+    std::size_t read = 0;
+    std::size_t index = FindEntry(offset);
+    while (read < length) {
+        const ConcatenationEntry& entry = files[index];
+        const u64 entry_offset = offset + read - entry.offset;
+        const std::size_t read_in = std::min<std::size_t>(entry.size - entry_offset, length - read);
+        const std::size_t entry_read = entry.file->Read(data + read, read_in, entry_offset);
+        read += entry_read;
+        if (entry_read != read_in) {
+            break;
+        }
+        if (read < length) {
+            ++index;
+        }
+    }
+    last_entry.store(index, std::memory_order_relaxed);
+    return read;
 }
 
 std::size_t ConcatenatedVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
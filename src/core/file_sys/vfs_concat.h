@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string_view>
+#include <vector>
 #include "core/file_sys/vfs.h"
 
 namespace FileSys {
@@ -39,8 +41,19 @@ public:
     bool Rename(std::string_view name) override;
 
 private:
-    // Maps starting offset to file -- more efficient.
-    std::multimap<u64, VirtualFile> files;
+    struct ConcatenationEntry {
+        u64 offset;
+        u64 size;
+        VirtualFile file;
+    };
+
+    /// Returns the index of the entry containing offset, which must be lower than the file size
+    std::size_t FindEntry(u64 offset) const;
+
+    // Files sorted by starting offset, empty files are not stored.
+    std::vector<ConcatenationEntry> files;
+    // Index of the entry hit by the last read, sequential reads usually hit it or the next one
+    mutable std::atomic<std::size_t> last_entry{0};
     std::string name;
 };
 
@@ -3,6 +3,8 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <string>
+#include <unordered_set>
 #include <utility>
 #include "core/file_sys/vfs_layered.h"
 
@@ -59,11 +61,10 @@ std::string LayeredVfsDirectory::GetFullPath() const {
 
 std::vector<std::shared_ptr<VfsFile>> LayeredVfsDirectory::GetFiles() const {
     std::vector<VirtualFile> out;
+    std::unordered_set<std::string> names;
     for (const auto& layer : dirs) {
         for (const auto& file : layer->GetFiles()) {
-            if (std::find_if(out.begin(), out.end(), [&file](const VirtualFile& comp) {
-                    return comp->GetName() == file->GetName();
-                }) == out.end()) {
+            if (names.insert(file->GetName()).second) {
                 out.push_back(file);
             }
         }
@@ -74,9 +75,10 @@ std::vector<std::shared_ptr<VfsFile>> LayeredVfsDirectory::GetFiles() const {
 
 std::vector<std::shared_ptr<VfsDirectory>> LayeredVfsDirectory::GetSubdirectories() const {
     std::vector<std::string> names;
+    std::unordered_set<std::string> known_names;
     for (const auto& layer : dirs) {
         for (const auto& sd : layer->GetSubdirectories()) {
-            if (std::find(names.begin(), names.end(), sd->GetName()) == names.end())
+            if (known_names.insert(sd->GetName()).second)
                 names.push_back(sd->GetName());
         }
     }
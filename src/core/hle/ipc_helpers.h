@@ -142,6 +142,8 @@ public:
         } else {
             auto& kernel = Core::System::GetInstance().Kernel();
             auto [client, server] = Kernel::Session::Create(kernel, iface->GetServiceName());
+            // Interfaces are executed by the thread of the service that opened them
+            server->SetServiceThread(context->Session()->GetServiceThread());
             context->AddMoveObject(std::move(client));
             iface->ClientConnected(std::move(server));
         }
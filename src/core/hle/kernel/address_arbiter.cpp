@@ -2,9 +2,6 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
-#include <algorithm>
-#include <vector>
-
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "core/arm/exclusive_monitor.h"
@@ -21,22 +18,21 @@
 
 namespace Kernel {
 
-// Wake up num_to_wake (or all) threads in a vector.
-void AddressArbiter::WakeThreads(const std::vector<std::shared_ptr<Thread>>& waiting_threads,
-                                 s32 num_to_wake) {
+// Wake up num_to_wake (or all) threads waiting on an address.
+void AddressArbiter::WakeThreads(VAddr address, s32 num_to_wake) {
     // Only process up to 'target' threads, unless 'target' is <= 0, in which case process
     // them all.
-    std::size_t last = waiting_threads.size();
-    if (num_to_wake > 0) {
-        last = std::min(last, static_cast<std::size_t>(num_to_wake));
-    }
+    for (s32 num_woken = 0; num_to_wake <= 0 || num_woken < num_to_wake; ++num_woken) {
+        Thread* const thread = arb_threads.Front(address);
+        if (thread == nullptr) {
+            break;
+        }
 
-    // Signal the waiting threads.
-    for (std::size_t i = 0; i < last; i++) {
-        waiting_threads[i]->SetSynchronizationResults(nullptr, RESULT_SUCCESS);
-        RemoveThread(waiting_threads[i]);
-        waiting_threads[i]->WaitForArbitration(false);
-        waiting_threads[i]->ResumeFromWait();
+        // Signal the waiting thread.
+        thread->SetSynchronizationResults(nullptr, RESULT_SUCCESS);
+        RemoveThread(thread);
+        thread->WaitForArbitration(false);
+        thread->ResumeFromWait();
     }
 }
 
@@ -59,9 +55,7 @@ ResultCode AddressArbiter::SignalToAddress(VAddr address, SignalType type, s32 v
 
 ResultCode AddressArbiter::SignalToAddressOnly(VAddr address, s32 num_to_wake) {
     SchedulerLock lock(system.Kernel());
-    const std::vector<std::shared_ptr<Thread>> waiting_threads =
-        GetThreadsWaitingOnAddress(address);
-    WakeThreads(waiting_threads, num_to_wake);
+    WakeThreads(address, num_to_wake);
     return RESULT_SUCCESS;
 }
 
@@ -100,9 +94,9 @@ ResultCode AddressArbiter::ModifyByWaitingCountAndSignalToAddressIfEqual(VAddr a
         return ERR_INVALID_ADDRESS_STATE;
     }
 
-    // Get threads waiting on the address.
-    const std::vector<std::shared_ptr<Thread>> waiting_threads =
-        GetThreadsWaitingOnAddress(address);
+    // Count threads waiting on the address, there is no need to look past num_to_wake + 1.
+    const std::size_t max_count = num_to_wake > 0 ? static_cast<std::size_t>(num_to_wake) + 1 : 1;
+    const std::size_t num_waiting = arb_threads.Count(address, max_count);
 
     const std::size_t current_core = system.CurrentCoreIndex();
     auto& monitor = system.Monitor();
@@ -115,15 +109,15 @@ ResultCode AddressArbiter::ModifyByWaitingCountAndSignalToAddressIfEqual(VAddr a
         }
         // Determine the modified value depending on the waiting count.
         if (num_to_wake <= 0) {
-            if (waiting_threads.empty()) {
+            if (num_waiting == 0) {
                 updated_value = value + 1;
             } else {
                 updated_value = value - 1;
             }
         } else {
-            if (waiting_threads.empty()) {
+            if (num_waiting == 0) {
                 updated_value = value + 1;
-            } else if (waiting_threads.size() <= static_cast<u32>(num_to_wake)) {
+            } else if (num_waiting <= static_cast<u32>(num_to_wake)) {
                 updated_value = value - 1;
             } else {
                 updated_value = value;
@@ -131,7 +125,7 @@ ResultCode AddressArbiter::ModifyByWaitingCountAndSignalToAddressIfEqual(VAddr a
         }
     } while (!monitor.ExclusiveWrite32(current_core, address, updated_value));
 
-    WakeThreads(waiting_threads, num_to_wake);
+    WakeThreads(address, num_to_wake);
     return RESULT_SUCCESS;
 }
 
@@ -199,7 +193,7 @@ ResultCode AddressArbiter::WaitForAddressIfLessThan(VAddr address, s32 value, s6
         }
 
         current_thread->SetArbiterWaitAddress(address);
-        InsertThread(SharedFrom(current_thread));
+        InsertThread(current_thread);
         current_thread->SetStatus(ThreadStatus::WaitArb);
         current_thread->WaitForArbitration(true);
     }
@@ -212,7 +206,7 @@ ResultCode AddressArbiter::WaitForAddressIfLessThan(VAddr address, s32 value, s6
     {
         SchedulerLock lock(kernel);
         if (current_thread->IsWaitingForArbitration()) {
-            RemoveThread(SharedFrom(current_thread));
+            RemoveThread(current_thread);
             current_thread->WaitForArbitration(false);
         }
     }
@@ -254,7 +248,7 @@ ResultCode AddressArbiter::WaitForAddressIfEqual(VAddr address, s32 value, s64 t
 
         current_thread->SetSynchronizationResults(nullptr, RESULT_TIMEOUT);
         current_thread->SetArbiterWaitAddress(address);
-        InsertThread(SharedFrom(current_thread));
+        InsertThread(current_thread);
         current_thread->SetStatus(ThreadStatus::WaitArb);
         current_thread->WaitForArbitration(true);
     }
@@ -267,7 +261,7 @@ ResultCode AddressArbiter::WaitForAddressIfEqual(VAddr address, s32 value, s64 t
     {
         SchedulerLock lock(kernel);
         if (current_thread->IsWaitingForArbitration()) {
-            RemoveThread(SharedFrom(current_thread));
+            RemoveThread(current_thread);
             current_thread->WaitForArbitration(false);
         }
     }
@@ -277,46 +271,16 @@ ResultCode AddressArbiter::WaitForAddressIfEqual(VAddr address, s32 value, s64 t
 
 void AddressArbiter::HandleWakeupThread(std::shared_ptr<Thread> thread) {
     ASSERT(thread->GetStatus() == ThreadStatus::WaitArb);
-    RemoveThread(thread);
+    RemoveThread(thread.get());
     thread->SetArbiterWaitAddress(0);
 }
 
-void AddressArbiter::InsertThread(std::shared_ptr<Thread> thread) {
-    const VAddr arb_addr = thread->GetArbiterWaitAddress();
-    std::list<std::shared_ptr<Thread>>& thread_list = arb_threads[arb_addr];
-
-    const auto iter =
-        std::find_if(thread_list.cbegin(), thread_list.cend(), [&thread](const auto& entry) {
-            return entry->GetPriority() >= thread->GetPriority();
-        });
-
-    if (iter == thread_list.cend()) {
-        thread_list.push_back(std::move(thread));
-    } else {
-        thread_list.insert(iter, std::move(thread));
-    }
+void AddressArbiter::InsertThread(Thread* thread) {
+    arb_threads.Insert(thread, thread->GetArbiterWaitAddress());
 }
 
-void AddressArbiter::RemoveThread(std::shared_ptr<Thread> thread) {
-    const VAddr arb_addr = thread->GetArbiterWaitAddress();
-    std::list<std::shared_ptr<Thread>>& thread_list = arb_threads[arb_addr];
-
-    const auto iter = std::find_if(thread_list.cbegin(), thread_list.cend(),
-                                   [&thread](const auto& entry) { return thread == entry; });
-
-    if (iter != thread_list.cend()) {
-        thread_list.erase(iter);
-    }
+void AddressArbiter::RemoveThread(Thread* thread) {
+    arb_threads.Remove(thread);
 }
 
-std::vector<std::shared_ptr<Thread>> AddressArbiter::GetThreadsWaitingOnAddress(
-    VAddr address) const {
-    const auto iter = arb_threads.find(address);
-    if (iter == arb_threads.cend()) {
-        return {};
-    }
-
-    const std::list<std::shared_ptr<Thread>>& thread_list = iter->second;
-    return {thread_list.cbegin(), thread_list.cend()};
-}
 } // namespace Kernel
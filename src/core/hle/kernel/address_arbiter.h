@@ -4,12 +4,10 @@
 
 #pragma once
 
-#include <list>
 #include <memory>
-#include <unordered_map>
-#include <vector>
 
 #include "common/common_types.h"
+#include "core/hle/kernel/thread_wait_queue.h"
 
 union ResultCode;
 
@@ -41,7 +39,7 @@ public:
     AddressArbiter(const AddressArbiter&) = delete;
     AddressArbiter& operator=(const AddressArbiter&) = delete;
 
-    AddressArbiter(AddressArbiter&&) = default;
+    AddressArbiter(AddressArbiter&&) = delete;
     AddressArbiter& operator=(AddressArbiter&&) = delete;
 
     /// Signals an address being waited on with a particular signaling type.
@@ -73,20 +71,17 @@ private:
     /// Waits on an address if the value passed is equal to the argument value.
     ResultCode WaitForAddressIfEqual(VAddr address, s32 value, s64 timeout);
 
-    /// Wake up num_to_wake (or all) threads in a vector.
-    void WakeThreads(const std::vector<std::shared_ptr<Thread>>& waiting_threads, s32 num_to_wake);
+    /// Wake up num_to_wake (or all) threads waiting on an address.
+    void WakeThreads(VAddr address, s32 num_to_wake);
 
     /// Insert a thread into the address arbiter container
-    void InsertThread(std::shared_ptr<Thread> thread);
+    void InsertThread(Thread* thread);
 
     /// Removes a thread from the address arbiter container
-    void RemoveThread(std::shared_ptr<Thread> thread);
+    void RemoveThread(Thread* thread);
 
-    // Gets the threads waiting on an address.
-    std::vector<std::shared_ptr<Thread>> GetThreadsWaitingOnAddress(VAddr address) const;
-
-    /// List of threads waiting for a address arbiter
-    std::unordered_map<VAddr, std::list<std::shared_ptr<Thread>>> arb_threads;
+    /// Threads waiting for a address arbiter
+    ThreadWaitQueue arb_threads;
 
     Core::System& system;
 };
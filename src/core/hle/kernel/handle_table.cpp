@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <mutex>
 #include <utility>
 #include "common/assert.h"
 #include "common/logging/log.h"
@@ -41,6 +42,7 @@ ResultCode HandleTable::SetSize(s32 handle_table_size) {
     // value in that case, since we assume this by default unless this function
     // is called.
     if (handle_table_size > 0) {
+        std::scoped_lock lk{lock};
         table_size = static_cast<u16>(handle_table_size);
     }
 
@@ -50,6 +52,7 @@ ResultCode HandleTable::SetSize(s32 handle_table_size) {
 ResultVal<Handle> HandleTable::Create(std::shared_ptr<Object> obj) {
     DEBUG_ASSERT(obj != nullptr);
 
+    std::scoped_lock lk{lock};
     const u16 slot = next_free_slot;
     if (slot >= table_size) {
         LOG_ERROR(Kernel, "Unable to allocate Handle, too many slots in use.");
@@ -82,21 +85,31 @@ ResultVal<Handle> HandleTable::Duplicate(Handle handle) {
 }
 
 ResultCode HandleTable::Close(Handle handle) {
-    if (!IsValid(handle)) {
-        LOG_ERROR(Kernel, "Handle is not valid! handle={:08X}", handle);
-        return ERR_INVALID_HANDLE;
-    }
+    // The object is released after the lock, its destructor may access other handle tables
+    std::shared_ptr<Object> object;
+    {
+        std::scoped_lock lk{lock};
+        if (!IsValidLocked(handle)) {
+            LOG_ERROR(Kernel, "Handle is not valid! handle={:08X}", handle);
+            return ERR_INVALID_HANDLE;
+        }
 
-    const u16 slot = GetSlot(handle);
+        const u16 slot = GetSlot(handle);
 
-    objects[slot] = nullptr;
+        object = std::move(objects[slot]);
 
-    generations[slot] = next_free_slot;
-    next_free_slot = slot;
+        generations[slot] = next_free_slot;
+        next_free_slot = slot;
+    }
     return RESULT_SUCCESS;
 }
 
 bool HandleTable::IsValid(Handle handle) const {
+    std::scoped_lock lk{lock};
+    return IsValidLocked(handle);
+}
+
+bool HandleTable::IsValidLocked(Handle handle) const {
     const std::size_t slot = GetSlot(handle);
     const u16 generation = GetGeneration(handle);
 
@@ -110,18 +123,23 @@ std::shared_ptr<Object> HandleTable::GetGeneric(Handle handle) const {
         return SharedFrom(kernel.CurrentProcess());
     }
 
-    if (!IsValid(handle)) {
+    std::scoped_lock lk{lock};
+    if (!IsValidLocked(handle)) {
         return nullptr;
     }
     return objects[GetSlot(handle)];
 }
 
 void HandleTable::Clear() {
-    for (u16 i = 0; i < table_size; ++i) {
-        generations[i] = static_cast<u16>(i + 1);
-        objects[i] = nullptr;
+    std::array<std::shared_ptr<Object>, MAX_COUNT> released;
+    {
+        std::scoped_lock lk{lock};
+        for (u16 i = 0; i < table_size; ++i) {
+            generations[i] = static_cast<u16>(i + 1);
+            released[i] = std::move(objects[i]);
+        }
+        next_free_slot = 0;
     }
-    next_free_slot = 0;
 }
 
 } // namespace Kernel
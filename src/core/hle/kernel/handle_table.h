@@ -9,6 +9,7 @@
 #include <memory>
 
 #include "common/common_types.h"
+#include "common/spin_lock.h"
 #include "core/hle/kernel/object.h"
 #include "core/hle/result.h"
 
@@ -44,6 +45,9 @@ enum KernelHandle : Handle {
  * is destroyed, it is again pushed onto the list to be re-used by the next allocation. It is
  * likely that this allocation strategy differs from the one used in CTR-OS, but this hasn't been
  * verified and isn't likely to cause any problems.
+ *
+ * Handles are created and looked up from SVCs on every core and from the HLE service threads, so
+ * the table is guarded by a lock. Objects released by the table are destroyed outside of it.
  */
 class HandleTable final : NonCopyable {
 public:
@@ -112,6 +116,12 @@ public:
     void Clear();
 
 private:
+    /// Checks if a handle is valid, the lock has to be held.
+    bool IsValidLocked(Handle handle) const;
+
+    /// Guards the slots, the free list and the generation counter.
+    mutable Common::SpinLock lock;
+
     /// Stores the Object referenced by the handle or null if the slot is empty.
     std::array<std::shared_ptr<Object>, MAX_COUNT> objects;
 
@@ -93,6 +93,28 @@ HLERequestContext::HLERequestContext(KernelCore& kernel, Core::Memory::Memory& m
 
 HLERequestContext::~HLERequestContext() = default;
 
+void HLERequestContext::Reset(std::shared_ptr<ServerSession> session,
+                              std::shared_ptr<Thread> thread_) {
+    server_session = std::move(session);
+    thread = std::move(thread_);
+    cmd_buf[0] = 0;
+    ClearIncomingObjects();
+    command_header.reset();
+    handle_descriptor_header.reset();
+    data_payload_header.reset();
+    domain_message_header.reset();
+    buffer_x_desciptors.clear();
+    buffer_a_desciptors.clear();
+    buffer_b_desciptors.clear();
+    buffer_w_desciptors.clear();
+    buffer_c_desciptors.clear();
+    data_payload_offset = 0;
+    buffer_c_offset = 0;
+    command = 0;
+    domain_request_handlers.clear();
+    is_thread_waiting = false;
+}
+
 void HLERequestContext::ParseCommandBuffer(const HandleTable& handle_table, u32_le* src_cmdbuf,
                                            bool incoming) {
     IPC::RequestParser rp(src_cmdbuf);
@@ -62,6 +62,15 @@ public:
      */
     virtual ResultCode HandleSyncRequest(Kernel::HLERequestContext& context) = 0;
 
+    /**
+     * Returns the name of the host thread that executes the requests of this handler in multicore
+     * mode. Handlers without one are executed by the core timing thread, serialized with every
+     * other service and with core timing events.
+     */
+    virtual std::string GetServiceThreadName() const {
+        return {};
+    }
+
     /**
      * Signals that a client has just connected to this HLE handler and keeps the
      * associated ServerSession alive for the duration of the connection.
@@ -104,11 +113,21 @@ protected:
  */
 class HLERequestContext {
 public:
+    /// Requests rarely use more than a few buffers of each kind, keep their descriptors inline
+    template <typename Descriptor>
+    using BufferDescriptorList = boost::container::small_vector<Descriptor, 4>;
+
     explicit HLERequestContext(KernelCore& kernel, Core::Memory::Memory& memory,
                                std::shared_ptr<ServerSession> session,
                                std::shared_ptr<Thread> thread);
     ~HLERequestContext();
 
+    /**
+     * Clears the state of a previous request so that this context can be reused, keeping the
+     * storage already allocated.
+     */
+    void Reset(std::shared_ptr<ServerSession> session, std::shared_ptr<Thread> thread);
+
     /// Returns a pointer to the IPC command buffer for this request.
     u32* CommandBuffer() {
         return cmd_buf.data();
@@ -161,19 +180,19 @@ public:
         return data_payload_offset;
     }
 
-    const std::vector<IPC::BufferDescriptorX>& BufferDescriptorX() const {
+    const BufferDescriptorList<IPC::BufferDescriptorX>& BufferDescriptorX() const {
         return buffer_x_desciptors;
     }
 
-    const std::vector<IPC::BufferDescriptorABW>& BufferDescriptorA() const {
+    const BufferDescriptorList<IPC::BufferDescriptorABW>& BufferDescriptorA() const {
         return buffer_a_desciptors;
     }
 
-    const std::vector<IPC::BufferDescriptorABW>& BufferDescriptorB() const {
+    const BufferDescriptorList<IPC::BufferDescriptorABW>& BufferDescriptorB() const {
         return buffer_b_desciptors;
     }
 
-    const std::vector<IPC::BufferDescriptorC>& BufferDescriptorC() const {
+    const BufferDescriptorList<IPC::BufferDescriptorC>& BufferDescriptorC() const {
         return buffer_c_desciptors;
     }
 
@@ -301,11 +320,11 @@ private:
     std::optional<IPC::HandleDescriptorHeader> handle_descriptor_header;
     std::optional<IPC::DataPayloadHeader> data_payload_header;
     std::optional<IPC::DomainMessageHeader> domain_message_header;
-    std::vector<IPC::BufferDescriptorX> buffer_x_desciptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_a_desciptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_b_desciptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_w_desciptors;
-    std::vector<IPC::BufferDescriptorC> buffer_c_desciptors;
+    BufferDescriptorList<IPC::BufferDescriptorX> buffer_x_desciptors;
+    BufferDescriptorList<IPC::BufferDescriptorABW> buffer_a_desciptors;
+    BufferDescriptorList<IPC::BufferDescriptorABW> buffer_b_desciptors;
+    BufferDescriptorList<IPC::BufferDescriptorABW> buffer_w_desciptors;
+    BufferDescriptorList<IPC::BufferDescriptorC> buffer_c_desciptors;
 
     unsigned data_payload_offset{};
     unsigned buffer_c_offset{};
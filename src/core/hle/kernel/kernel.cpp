@@ -7,6 +7,8 @@
 #include <bitset>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
 #include <unordered_map>
 #include <utility>
@@ -35,6 +37,7 @@
 #include "core/hle/kernel/process.h"
 #include "core/hle/kernel/resource_limit.h"
 #include "core/hle/kernel/scheduler.h"
+#include "core/hle/kernel/service_thread.h"
 #include "core/hle/kernel/shared_memory.h"
 #include "core/hle/kernel/synchronization.h"
 #include "core/hle/kernel/thread.h"
@@ -47,6 +50,23 @@ MICROPROFILE_DEFINE(Kernel_SVC, "Kernel", "SVC", MP_RGB(70, 200, 70));
 
 namespace Kernel {
 
+namespace {
+
+/// Registration of the current host thread, looked up once per kernel session. The scheduler
+/// lock and every CurrentScheduler call need it, scanning the registry each time is too slow.
+struct HostThreadCache {
+    const void* owner = nullptr;
+    u64 generation = 0;
+    u32 host_thread_id = Core::INVALID_HOST_THREAD_ID;
+};
+
+thread_local HostThreadCache host_thread_cache;
+
+/// Incremented whenever a kernel resets its registry, invalidating every cached registration
+std::atomic<u64> host_thread_generation{1};
+
+} // Anonymous namespace
+
 struct KernelCore::Impl {
     explicit Impl(Core::System& system, KernelCore& kernel)
         : global_scheduler{kernel}, synchronization{system}, time_manager{system},
@@ -69,6 +89,12 @@ struct KernelCore::Impl {
     }
 
     void Shutdown() {
+        // Service threads are registered host threads, stop them before resetting the registry
+        {
+            std::scoped_lock lock{service_threads_mutex};
+            service_threads.clear();
+        }
+
         next_object_id = 0;
         next_kernel_process_id = Process::InitialKIPIDMin;
         next_user_process_id = Process::ProcessIDMin;
@@ -106,6 +132,7 @@ struct KernelCore::Impl {
         exclusive_monitor.reset();
 
         num_host_threads = 0;
+        ++host_thread_generation;
         std::fill(register_host_thread_keys.begin(), register_host_thread_keys.end(),
                   std::thread::id{});
         std::fill(register_host_thread_values.begin(), register_host_thread_values.end(), 0);
@@ -215,6 +242,7 @@ struct KernelCore::Impl {
         ASSERT_MSG(index < NUM_REGISTRABLE_HOST_THREADS, "Too many host threads");
         register_host_thread_values[index] = value;
         register_host_thread_keys[index] = std::this_thread::get_id();
+        host_thread_cache = {this, host_thread_generation.load(), value};
     }
 
     [[nodiscard]] u32 GetCurrentHostThreadID() const {
@@ -222,14 +250,20 @@ struct KernelCore::Impl {
         if (!is_multicore && single_core_thread_id == this_id) {
             return static_cast<u32>(system.GetCpuManager().CurrentCore());
         }
+        const u64 generation = host_thread_generation.load(std::memory_order_relaxed);
+        if (host_thread_cache.owner == this && host_thread_cache.generation == generation) {
+            return host_thread_cache.host_thread_id;
+        }
         const auto end =
             register_host_thread_keys.begin() + static_cast<ptrdiff_t>(num_host_threads);
         const auto it = std::find(register_host_thread_keys.begin(), end, this_id);
         if (it == end) {
             return Core::INVALID_HOST_THREAD_ID;
         }
-        return register_host_thread_values[static_cast<size_t>(
+        const u32 host_thread_id = register_host_thread_values[static_cast<size_t>(
             std::distance(register_host_thread_keys.begin(), it))];
+        host_thread_cache = {this, generation, host_thread_id};
+        return host_thread_id;
     }
 
     Core::EmuThreadHandle GetCurrentEmuThreadID() const {
@@ -329,8 +363,26 @@ struct KernelCore::Impl {
     // 0-3 IDs represent core threads, >3 represent others
     std::atomic<u32> registered_thread_ids{Core::Hardware::NUM_CPU_CORES};
 
+    std::weak_ptr<ServiceThread> GetServiceThread(KernelCore& kernel, const std::string& name) {
+        if (!is_multicore) {
+            return {};
+        }
+        std::scoped_lock lock{service_threads_mutex};
+        if (const auto it = service_threads.find(name); it != service_threads.end()) {
+            return it->second;
+        }
+        // Services share a thread once the limit is reached
+        const std::string thread_name =
+            service_threads.size() < MAX_SERVICE_THREADS ? name : DEFAULT_SERVICE_THREAD;
+        auto& service_thread = service_threads[thread_name];
+        if (!service_thread) {
+            service_thread = std::make_shared<ServiceThread>(kernel, thread_name);
+        }
+        return service_thread;
+    }
+
     // Number of host threads is a relatively high number to avoid overflowing
-    static constexpr size_t NUM_REGISTRABLE_HOST_THREADS = 64;
+    static constexpr size_t NUM_REGISTRABLE_HOST_THREADS = 128;
     std::atomic<size_t> num_host_threads{0};
     std::array<std::atomic<std::thread::id>, NUM_REGISTRABLE_HOST_THREADS>
         register_host_thread_keys{};
@@ -351,6 +403,11 @@ struct KernelCore::Impl {
     std::array<std::unique_ptr<Kernel::Scheduler>, Core::Hardware::NUM_CPU_CORES> schedulers{};
 
     bool is_multicore{};
+
+    static constexpr size_t MAX_SERVICE_THREADS = 48;
+    static constexpr const char* DEFAULT_SERVICE_THREAD = "Default";
+    std::mutex service_threads_mutex;
+    std::unordered_map<std::string, std::shared_ptr<ServiceThread>> service_threads;
     std::thread::id single_core_thread_id{};
 
     std::array<u64, Core::Hardware::NUM_CPU_CORES> svc_ticks{};
@@ -503,6 +560,10 @@ void KernelCore::AddNamedPort(std::string name, std::shared_ptr<ClientPort> port
     impl->named_ports.emplace(std::move(name), std::move(port));
 }
 
+std::weak_ptr<ServiceThread> KernelCore::GetServiceThread(const std::string& name) {
+    return impl->GetServiceThread(*this, name);
+}
+
 KernelCore::NamedPortTable::iterator KernelCore::FindNamedPort(const std::string& name) {
     return impl->named_ports.find(name);
 }
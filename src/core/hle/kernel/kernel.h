@@ -41,6 +41,7 @@ class PhysicalCore;
 class Process;
 class ResourceLimit;
 class Scheduler;
+class ServiceThread;
 class SharedMemory;
 class Synchronization;
 class Thread;
@@ -165,6 +166,13 @@ public:
     /// Determines whether or not the given port is a valid named port.
     bool IsValidNamedPort(NamedPortTable::const_iterator port) const;
 
+    /**
+     * Gets the host thread with the given name executing HLE requests, creating it if needed.
+     * Returns an empty pointer in single core mode, where requests are executed by the core
+     * timing thread.
+     */
+    std::weak_ptr<ServiceThread> GetServiceThread(const std::string& name);
+
     /// Gets the current host_thread/guest_thread handle.
     Core::EmuThreadHandle GetCurrentEmuThreadID() const;
 
@@ -761,19 +761,19 @@ ResultCode PageTable::SetHeapCapacity(std::size_t new_heap_capacity) {
 }
 
 ResultVal<VAddr> PageTable::SetHeapSize(std::size_t size) {
-
     if (size > heap_region_end - heap_region_start) {
         return ERR_OUT_OF_MEMORY;
     }
 
+    // The current heap size is read under the lock so concurrent calls see each other's changes
+    std::lock_guard lock{page_table_lock};
+
     const u64 previous_heap_size{GetHeapSize()};
 
     UNIMPLEMENTED_IF_MSG(previous_heap_size > size, "Heap shrink is unimplemented");
 
     // Increase the heap size
     {
-        std::lock_guard lock{page_table_lock};
-
         const u64 delta{size - previous_heap_size};
 
         auto process{system.Kernel().CurrentProcess()};
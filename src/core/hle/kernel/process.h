@@ -16,6 +16,7 @@
 #include "core/hle/kernel/mutex.h"
 #include "core/hle/kernel/process_capability.h"
 #include "core/hle/kernel/synchronization_object.h"
+#include "core/hle/kernel/thread_wait_queue.h"
 #include "core/hle/result.h"
 
 namespace Core {
@@ -241,13 +242,13 @@ public:
     }
 
     /// Insert a thread into the condition variable wait container
-    void InsertConditionVariableThread(std::shared_ptr<Thread> thread);
+    void InsertConditionVariableThread(Thread* thread);
 
     /// Remove a thread from the condition variable wait container
-    void RemoveConditionVariableThread(std::shared_ptr<Thread> thread);
+    void RemoveConditionVariableThread(Thread* thread);
 
-    /// Obtain all condition variable threads waiting for some address
-    std::vector<std::shared_ptr<Thread>> GetConditionVariableThreads(VAddr cond_var_addr);
+    /// Obtain the highest priority thread waiting for a condition variable, or nullptr if none
+    Thread* GetFirstConditionVariableThread(VAddr cond_var_addr) const;
 
     /// Registers a thread as being created under this process,
     /// adding it to this process' thread list.
@@ -379,8 +380,8 @@ private:
     /// List of threads that are running with this process as their owner.
     std::list<const Thread*> thread_list;
 
-    /// List of threads waiting for a condition variable
-    std::unordered_map<VAddr, std::list<std::shared_ptr<Thread>>> cond_var_threads;
+    /// Threads waiting for a condition variable
+    ThreadWaitQueue cond_var_threads;
 
     /// Address of the top of the main thread's stack
     VAddr main_thread_stack_top{};
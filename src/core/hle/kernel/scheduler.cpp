@@ -58,7 +58,8 @@ u32 GlobalScheduler::SelectThreads() {
         std::atomic_thread_fence(std::memory_order_seq_cst);
         return reschedule_pending;
     };
-    if (!is_reselection_pending.load()) {
+    u32 cores_to_update = cores_pending_reselection.exchange(0, std::memory_order_acq_rel);
+    if (cores_to_update == 0) {
         return 0;
     }
     std::array<Thread*, Core::Hardware::NUM_CPU_CORES> top_threads{};
@@ -128,8 +129,16 @@ u32 GlobalScheduler::SelectThreads() {
 
         idle_cores &= ~(1U << core_id);
     }
+    // Migrations above may have changed the queues of more cores
+    cores_to_update |= cores_pending_reselection.exchange(0, std::memory_order_acq_rel);
+
+    // Cores with untouched queues keep their selection and have already been interrupted if a
+    // context switch was pending, skip them to avoid redundant interrupts
     u32 cores_needing_context_switch{};
     for (u32 core = 0; core < Core::Hardware::NUM_CPU_CORES; core++) {
+        if ((cores_to_update & (1U << core)) == 0) {
+            continue;
+        }
         Scheduler& sched = kernel.Scheduler(core);
         ASSERT(top_threads[core] == nullptr ||
                static_cast<u32>(top_threads[core]->GetProcessorID()) == core);
@@ -145,7 +154,7 @@ bool GlobalScheduler::YieldThread(Thread* yielding_thread) {
     // Note: caller should use critical section, etc.
     if (!yielding_thread->IsRunnable()) {
         // Normally this case shouldn't happen except for SetThreadActivity.
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
         return false;
     }
     const u32 core_id = static_cast<u32>(yielding_thread->GetProcessorID());
@@ -155,7 +164,7 @@ bool GlobalScheduler::YieldThread(Thread* yielding_thread) {
     Reschedule(priority, core_id, yielding_thread);
     const Thread* const winner = scheduled_queue[core_id].front();
     if (kernel.GetCurrentHostThreadID() != core_id) {
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
     }
 
     return AskForReselectionOrMarkRedundant(yielding_thread, winner);
@@ -167,7 +176,7 @@ bool GlobalScheduler::YieldThreadAndBalanceLoad(Thread* yielding_thread) {
     // etc.
     if (!yielding_thread->IsRunnable()) {
         // Normally this case shouldn't happen except for SetThreadActivity.
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
         return false;
     }
     const u32 core_id = static_cast<u32>(yielding_thread->GetProcessorID());
@@ -211,7 +220,7 @@ bool GlobalScheduler::YieldThreadAndBalanceLoad(Thread* yielding_thread) {
     }
 
     if (kernel.GetCurrentHostThreadID() != core_id) {
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
     }
 
     return AskForReselectionOrMarkRedundant(yielding_thread, winner);
@@ -223,7 +232,7 @@ bool GlobalScheduler::YieldThreadAndWaitForLoadBalancing(Thread* yielding_thread
     // etc.
     if (!yielding_thread->IsRunnable()) {
         // Normally this case shouldn't happen except for SetThreadActivity.
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
         return false;
     }
     Thread* winner = nullptr;
@@ -263,7 +272,7 @@ bool GlobalScheduler::YieldThreadAndWaitForLoadBalancing(Thread* yielding_thread
     }
 
     if (kernel.GetCurrentHostThreadID() != core_id) {
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
     }
 
     return AskForReselectionOrMarkRedundant(yielding_thread, winner);
@@ -346,7 +355,7 @@ void GlobalScheduler::PreemptThreads() {
             }
         }
 
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
     }
 }
 
@@ -377,34 +386,40 @@ void GlobalScheduler::EnableInterruptAndSchedule(u32 cores_pending_reschedule,
 void GlobalScheduler::Suggest(u32 priority, std::size_t core, Thread* thread) {
     ASSERT(is_locked);
     suggested_queue[core].add(thread, priority);
+    SetReselectionPending(core);
 }
 
 void GlobalScheduler::Unsuggest(u32 priority, std::size_t core, Thread* thread) {
     ASSERT(is_locked);
     suggested_queue[core].remove(thread, priority);
+    SetReselectionPending(core);
 }
 
 void GlobalScheduler::Schedule(u32 priority, std::size_t core, Thread* thread) {
     ASSERT(is_locked);
     ASSERT_MSG(thread->GetProcessorID() == s32(core), "Thread must be assigned to this core.");
     scheduled_queue[core].add(thread, priority);
+    SetReselectionPending(core);
 }
 
 void GlobalScheduler::SchedulePrepend(u32 priority, std::size_t core, Thread* thread) {
     ASSERT(is_locked);
     ASSERT_MSG(thread->GetProcessorID() == s32(core), "Thread must be assigned to this core.");
     scheduled_queue[core].add(thread, priority, false);
+    SetReselectionPending(core);
 }
 
 void GlobalScheduler::Reschedule(u32 priority, std::size_t core, Thread* thread) {
     ASSERT(is_locked);
     scheduled_queue[core].remove(thread, priority);
     scheduled_queue[core].add(thread, priority);
+    SetReselectionPending(core);
 }
 
 void GlobalScheduler::Unschedule(u32 priority, std::size_t core, Thread* thread) {
     ASSERT(is_locked);
     scheduled_queue[core].remove(thread, priority);
+    SetReselectionPending(core);
 }
 
 void GlobalScheduler::TransferToCore(u32 priority, s32 destination_core, Thread* thread) {
@@ -433,7 +448,7 @@ bool GlobalScheduler::AskForReselectionOrMarkRedundant(Thread* current_thread,
         current_thread->IncrementYieldCount();
         return true;
     } else {
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
         return false;
     }
 }
@@ -469,8 +484,6 @@ void GlobalScheduler::AdjustSchedulingOnStatus(Thread* thread, u32 old_flags) {
             }
         }
     }
-
-    SetReselectionPending();
 }
 
 void GlobalScheduler::AdjustSchedulingOnPriority(Thread* thread, u32 old_priority) {
@@ -505,7 +518,6 @@ void GlobalScheduler::AdjustSchedulingOnPriority(Thread* thread, u32 old_priorit
         }
     }
     thread->IncrementYieldCount();
-    SetReselectionPending();
 }
 
 void GlobalScheduler::AdjustSchedulingOnAffinity(Thread* thread, u64 old_affinity_mask,
@@ -537,7 +549,6 @@ void GlobalScheduler::AdjustSchedulingOnAffinity(Thread* thread, u64 old_affinit
     }
 
     thread->IncrementYieldCount();
-    SetReselectionPending();
 }
 
 void GlobalScheduler::Shutdown() {
@@ -729,15 +740,15 @@ void Scheduler::SwitchContext() {
         previous_thread->context_guard.unlock();
     }
 
-    std::shared_ptr<Common::Fiber>* old_context;
+    Common::Fiber* old_context;
     if (previous_thread != nullptr) {
-        old_context = &previous_thread->GetHostContext();
+        old_context = previous_thread->GetHostContext().get();
     } else {
-        old_context = &idle_thread->GetHostContext();
+        old_context = idle_thread->GetHostContext().get();
     }
     guard.unlock();
 
-    Common::Fiber::YieldTo(*old_context, switch_fiber);
+    Common::Fiber::YieldTo(old_context, switch_fiber.get());
     /// When a thread wakes up, the scheduler may have changed to other in another core.
     auto& next_scheduler = system.Kernel().CurrentScheduler();
     next_scheduler.SwitchContextStep2();
@@ -772,13 +783,13 @@ void Scheduler::SwitchToCurrent() {
                     break;
                 }
             }
-            std::shared_ptr<Common::Fiber>* next_context;
+            Common::Fiber* next_context;
             if (current_thread != nullptr) {
-                next_context = &current_thread->GetHostContext();
+                next_context = current_thread->GetHostContext().get();
             } else {
-                next_context = &idle_thread->GetHostContext();
+                next_context = idle_thread->GetHostContext().get();
             }
-            Common::Fiber::YieldTo(switch_fiber, *next_context);
+            Common::Fiber::YieldTo(switch_fiber.get(), next_context);
         } while (!is_switch_pending());
     }
 }
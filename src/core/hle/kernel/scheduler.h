@@ -114,11 +114,11 @@ public:
     }
 
     void SetReselectionPending() {
-        is_reselection_pending.store(true, std::memory_order_release);
+        cores_pending_reselection.fetch_or(ALL_CORES_MASK, std::memory_order_release);
     }
 
     bool IsReselectionPending() const {
-        return is_reselection_pending.load(std::memory_order_acquire);
+        return cores_pending_reselection.load(std::memory_order_acquire) != 0;
     }
 
     void Shutdown();
@@ -175,12 +175,18 @@ private:
 
     bool AskForReselectionOrMarkRedundant(Thread* current_thread, const Thread* winner);
 
+    /// Marks a core whose queues have changed, only those cores get a new thread selected
+    void SetReselectionPending(std::size_t core) {
+        cores_pending_reselection.fetch_or(1U << core, std::memory_order_release);
+    }
+
+    static constexpr u32 ALL_CORES_MASK = (1U << Core::Hardware::NUM_CPU_CORES) - 1;
     static constexpr u32 min_regular_priority = 2;
     std::array<Common::MultiLevelQueue<Thread*, THREADPRIO_COUNT>, Core::Hardware::NUM_CPU_CORES>
         scheduled_queue;
     std::array<Common::MultiLevelQueue<Thread*, THREADPRIO_COUNT>, Core::Hardware::NUM_CPU_CORES>
         suggested_queue;
-    std::atomic<bool> is_reselection_pending{false};
+    std::atomic<u32> cores_pending_reselection{0};
 
     // The priority levels at which the global scheduler preempts threads every 10 ms. They are
     // ordered from Core 0 to Core 3.
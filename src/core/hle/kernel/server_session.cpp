@@ -18,6 +18,7 @@
 #include "core/hle/kernel/process.h"
 #include "core/hle/kernel/scheduler.h"
 #include "core/hle/kernel/server_session.h"
+#include "core/hle/kernel/service_thread.h"
 #include "core/hle/kernel/session.h"
 #include "core/hle/kernel/thread.h"
 #include "core/memory.h"
@@ -34,7 +35,11 @@ ResultVal<std::shared_ptr<ServerSession>> ServerSession::Create(KernelCore& kern
 
     session->request_event =
         Core::Timing::CreateEvent(name, [session](std::uintptr_t, std::chrono::nanoseconds) {
-            session->CompleteSyncRequest();
+            ASSERT(!session->request_queue.Empty());
+            auto& context = session->request_queue.Front();
+            session->CompleteSyncRequest(*context);
+            session->ReleaseRequestContext(std::move(context));
+            session->request_queue.Pop();
         });
     session->name = std::move(name);
     session->parent = std::move(parent);
@@ -136,23 +141,42 @@ ResultCode ServerSession::HandleDomainSyncRequest(Kernel::HLERequestContext& con
     return RESULT_SUCCESS;
 }
 
-ResultCode ServerSession::QueueSyncRequest(std::shared_ptr<Thread> thread,
-                                           Core::Memory::Memory& memory) {
-    u32* cmd_buf{reinterpret_cast<u32*>(memory.GetPointer(thread->GetTLSAddress()))};
-    auto context =
-        std::make_shared<HLERequestContext>(kernel, memory, SharedFrom(this), std::move(thread));
-
-    context->PopulateFromIncomingCommandBuffer(kernel.CurrentProcess()->GetHandleTable(), cmd_buf);
-    request_queue.Push(std::move(context));
+void ServerSession::SetHleHandler(std::shared_ptr<SessionRequestHandler> hle_handler_) {
+    hle_handler = std::move(hle_handler_);
 
-    return RESULT_SUCCESS;
+    // Interfaces opened by a service have already been bound to the thread of the service
+    if (hle_handler && !service_thread.lock()) {
+        if (const std::string thread_name = hle_handler->GetServiceThreadName();
+            !thread_name.empty()) {
+            service_thread = kernel.GetServiceThread(thread_name);
+        }
+    }
 }
 
-ResultCode ServerSession::CompleteSyncRequest() {
-    ASSERT(!request_queue.Empty());
+std::shared_ptr<HLERequestContext> ServerSession::CreateRequestContext(
+    std::shared_ptr<Thread> thread, Core::Memory::Memory& memory) {
+    u32* cmd_buf{reinterpret_cast<u32*>(memory.GetPointer(thread->GetTLSAddress()))};
 
-    auto& context = *request_queue.Front();
+    std::shared_ptr<HLERequestContext> context;
+    {
+        std::scoped_lock lock{free_request_contexts_mutex};
+        if (!free_request_contexts.empty()) {
+            context = std::move(free_request_contexts.back());
+            free_request_contexts.pop_back();
+        }
+    }
+    if (context) {
+        context->Reset(SharedFrom(this), std::move(thread));
+    } else {
+        context = std::make_shared<HLERequestContext>(kernel, memory, SharedFrom(this),
+                                                      std::move(thread));
+    }
+
+    context->PopulateFromIncomingCommandBuffer(kernel.CurrentProcess()->GetHandleTable(), cmd_buf);
+    return context;
+}
 
+ResultCode ServerSession::CompleteSyncRequest(HLERequestContext& context) {
     ResultCode result = RESULT_SUCCESS;
     // If the session has been converted to a domain, handle the domain request
     if (IsDomain() && context.HasDomainMessageHeader()) {
@@ -178,18 +202,38 @@ ResultCode ServerSession::CompleteSyncRequest() {
         }
     }
 
-    request_queue.Pop();
-
     return result;
 }
 
+void ServerSession::ReleaseRequestContext(std::shared_ptr<HLERequestContext>&& context) {
+    // Only a handful of requests are in flight on a session at any time
+    constexpr std::size_t max_free_contexts = 4;
+
+    if (context.use_count() != 1) {
+        return;
+    }
+    // Drop the references held by the context, the session would otherwise keep itself alive
+    context->Reset(nullptr, nullptr);
+
+    std::scoped_lock lock{free_request_contexts_mutex};
+    if (free_request_contexts.size() < max_free_contexts) {
+        free_request_contexts.push_back(std::move(context));
+    }
+}
+
 ResultCode ServerSession::HandleSyncRequest(std::shared_ptr<Thread> thread,
                                             Core::Memory::Memory& memory,
                                             Core::Timing::CoreTiming& core_timing) {
-    const ResultCode result = QueueSyncRequest(std::move(thread), memory);
+    auto context = CreateRequestContext(std::move(thread), memory);
+    if (const auto strong_service_thread = service_thread.lock()) {
+        strong_service_thread->QueueSyncRequest(std::move(context));
+        return RESULT_SUCCESS;
+    }
+
+    request_queue.Push(std::move(context));
     const auto delay = std::chrono::nanoseconds{kernel.IsMulticore() ? 0 : 20000};
     core_timing.ScheduleEvent(delay, request_event, {});
-    return result;
+    return RESULT_SUCCESS;
 }
 
 } // namespace Kernel
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -26,6 +27,7 @@ namespace Kernel {
 
 class HLERequestContext;
 class KernelCore;
+class ServiceThread;
 class Session;
 class SessionRequestHandler;
 class Thread;
@@ -81,9 +83,7 @@ public:
      * instead of the regular IPC machinery. (The regular IPC machinery is currently not
      * implemented.)
      */
-    void SetHleHandler(std::shared_ptr<SessionRequestHandler> hle_handler_) {
-        hle_handler = std::move(hle_handler_);
-    }
+    void SetHleHandler(std::shared_ptr<SessionRequestHandler> hle_handler_);
 
     /**
      * Handle a sync request from the emulated application.
@@ -127,12 +127,26 @@ public:
         convert_to_domain = true;
     }
 
-private:
-    /// Queues a sync request from the emulated application.
-    ResultCode QueueSyncRequest(std::shared_ptr<Thread> thread, Core::Memory::Memory& memory);
+    /// Sets the host thread that executes the HLE requests of this session.
+    void SetServiceThread(std::weak_ptr<ServiceThread> service_thread_) {
+        service_thread = std::move(service_thread_);
+    }
+
+    /// Returns the host thread that executes the HLE requests of this session, if any.
+    const std::weak_ptr<ServiceThread>& GetServiceThread() const {
+        return service_thread;
+    }
 
     /// Completes a sync request from the emulated application.
-    ResultCode CompleteSyncRequest();
+    ResultCode CompleteSyncRequest(HLERequestContext& context);
+
+    /// Returns the context of a completed request to this session for reuse.
+    void ReleaseRequestContext(std::shared_ptr<HLERequestContext>&& context);
+
+private:
+    /// Creates the request context of a sync request from the emulated application.
+    std::shared_ptr<HLERequestContext> CreateRequestContext(std::shared_ptr<Thread> thread,
+                                                            Core::Memory::Memory& memory);
 
     /// Handles a SyncRequest to a domain, forwarding the request to the proper object or closing an
     /// object handle.
@@ -168,6 +182,13 @@ private:
 
     /// Queue of scheduled service requests
     Common::MPSCQueue<std::shared_ptr<Kernel::HLERequestContext>> request_queue;
+
+    /// Host thread executing the requests, the core timing thread is used when not set
+    std::weak_ptr<ServiceThread> service_thread;
+
+    /// Request contexts of completed requests, kept to avoid allocating one per request
+    std::vector<std::shared_ptr<HLERequestContext>> free_request_contexts;
+    std::mutex free_request_contexts_mutex;
 };
 
 } // namespace Kernel
@@ -0,0 +1,91 @@
+// Copyright 2020 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include "common/microprofile.h"
+#include "common/thread.h"
+#include "core/hle/kernel/hle_ipc.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/server_session.h"
+#include "core/hle/kernel/service_thread.h"
+
+namespace Kernel {
+
+class ServiceThread::Impl final {
+public:
+    explicit Impl(KernelCore& kernel, const std::string& name);
+    ~Impl();
+
+    void QueueSyncRequest(std::shared_ptr<HLERequestContext>&& context);
+
+private:
+    void Run(KernelCore& kernel, const std::string& name);
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::queue<std::shared_ptr<HLERequestContext>> requests;
+    bool stop = false;
+    std::thread thread;
+};
+
+ServiceThread::Impl::Impl(KernelCore& kernel, const std::string& name)
+    : thread{[this, &kernel, name] { Run(kernel, name); }} {}
+
+ServiceThread::Impl::~Impl() {
+    {
+        std::scoped_lock lock{mutex};
+        stop = true;
+    }
+    condition.notify_one();
+    thread.join();
+}
+
+void ServiceThread::Impl::QueueSyncRequest(std::shared_ptr<HLERequestContext>&& context) {
+    {
+        std::scoped_lock lock{mutex};
+        requests.push(std::move(context));
+    }
+    condition.notify_one();
+}
+
+void ServiceThread::Impl::Run(KernelCore& kernel, const std::string& name) {
+    kernel.RegisterHostThread();
+
+    const std::string thread_name = fmt::format("yuzu:HleService:{}", name);
+    MicroProfileOnThreadCreate(thread_name.c_str());
+    Common::SetCurrentThreadName(thread_name.c_str());
+
+    while (true) {
+        std::shared_ptr<HLERequestContext> context;
+        {
+            std::unique_lock lock{mutex};
+            condition.wait(lock, [this] { return stop || !requests.empty(); });
+            if (stop) {
+                return;
+            }
+            context = std::move(requests.front());
+            requests.pop();
+        }
+        const std::shared_ptr<ServerSession> session = context->Session();
+        session->CompleteSyncRequest(*context);
+        session->ReleaseRequestContext(std::move(context));
+    }
+}
+
+ServiceThread::ServiceThread(KernelCore& kernel, const std::string& name)
+    : impl{std::make_unique<Impl>(kernel, name)} {}
+
+ServiceThread::~ServiceThread() = default;
+
+void ServiceThread::QueueSyncRequest(std::shared_ptr<HLERequestContext>&& context) {
+    impl->QueueSyncRequest(std::move(context));
+}
+
+} // namespace Kernel
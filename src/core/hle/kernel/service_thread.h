@@ -0,0 +1,34 @@
+// Copyright 2020 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace Kernel {
+
+class HLERequestContext;
+class KernelCore;
+
+/**
+ * Host thread that executes the HLE requests of a group of sessions. Services with self-contained
+ * state get their own thread so they run concurrently with the rest, while requests to the same
+ * service are executed in submission order. Client threads stay in WaitIPC until their request
+ * completes.
+ */
+class ServiceThread final {
+public:
+    explicit ServiceThread(KernelCore& kernel, const std::string& name);
+    ~ServiceThread();
+
+    /// Queues a request, the reply is written back and the client woken up from the service thread
+    void QueueSyncRequest(std::shared_ptr<HLERequestContext>&& context);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+} // namespace Kernel
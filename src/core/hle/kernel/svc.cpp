@@ -164,7 +164,6 @@ ResultVal<s64> RetrieveResourceLimitValue(Core::System& system, Handle resource_
 
 /// Set the process heap to a given Size. It can both extend and shrink the heap.
 static ResultCode SetHeapSize(Core::System& system, VAddr* heap_addr, u64 heap_size) {
-    std::lock_guard lock{HLE::g_hle_lock};
     LOG_TRACE(Kernel_SVC, "called, heap_size=0x{:X}", heap_size);
 
     // Size must be a multiple of 0x200000 (2MB) and be equal to or less than 8GB.
@@ -195,7 +194,6 @@ static ResultCode SetHeapSize32(Core::System& system, u32* heap_addr, u32 heap_s
 
 static ResultCode SetMemoryAttribute(Core::System& system, VAddr address, u64 size, u32 mask,
                                      u32 attribute) {
-    std::lock_guard lock{HLE::g_hle_lock};
     LOG_DEBUG(Kernel_SVC,
               "called, address=0x{:016X}, size=0x{:X}, mask=0x{:08X}, attribute=0x{:08X}", address,
               size, mask, attribute);
@@ -240,7 +238,6 @@ static ResultCode SetMemoryAttribute32(Core::System& system, u32 address, u32 si
 
 /// Maps a memory range into a different range.
 static ResultCode MapMemory(Core::System& system, VAddr dst_addr, VAddr src_addr, u64 size) {
-    std::lock_guard lock{HLE::g_hle_lock};
     LOG_TRACE(Kernel_SVC, "called, dst_addr=0x{:X}, src_addr=0x{:X}, size=0x{:X}", dst_addr,
               src_addr, size);
 
@@ -261,7 +258,6 @@ static ResultCode MapMemory32(Core::System& system, u32 dst_addr, u32 src_addr,
 
 /// Unmaps a region that was previously mapped with svcMapMemory
 static ResultCode UnmapMemory(Core::System& system, VAddr dst_addr, VAddr src_addr, u64 size) {
-    std::lock_guard lock{HLE::g_hle_lock};
     LOG_TRACE(Kernel_SVC, "called, dst_addr=0x{:X}, src_addr=0x{:X}, size=0x{:X}", dst_addr,
               src_addr, size);
 
@@ -694,7 +690,6 @@ static void OutputDebugString([[maybe_unused]] Core::System& system, VAddr addre
 /// Gets system/memory information for the current process
 static ResultCode GetInfo(Core::System& system, u64* result, u64 info_id, u64 handle,
                           u64 info_sub_id) {
-    std::lock_guard lock{HLE::g_hle_lock};
     LOG_TRACE(Kernel_SVC, "called info_id=0x{:X}, info_sub_id=0x{:X}, handle=0x{:08X}", info_id,
               info_sub_id, handle);
 
@@ -960,7 +955,6 @@ static ResultCode GetInfo32(Core::System& system, u32* result_low, u32* result_h
 
 /// Maps memory at a desired address
 static ResultCode MapPhysicalMemory(Core::System& system, VAddr addr, u64 size) {
-    std::lock_guard lock{HLE::g_hle_lock};
     LOG_DEBUG(Kernel_SVC, "called, addr=0x{:016X}, size=0x{:X}", addr, size);
 
     if (!Common::Is4KBAligned(addr)) {
@@ -1014,7 +1008,6 @@ static ResultCode MapPhysicalMemory32(Core::System& system, u32 addr, u32 size)
 
 /// Unmaps memory previously mapped via MapPhysicalMemory
 static ResultCode UnmapPhysicalMemory(Core::System& system, VAddr addr, u64 size) {
-    std::lock_guard lock{HLE::g_hle_lock};
     LOG_DEBUG(Kernel_SVC, "called, addr=0x{:016X}, size=0x{:X}", addr, size);
 
     if (!Common::Is4KBAligned(addr)) {
@@ -1208,7 +1201,6 @@ static u32 GetCurrentProcessorNumber32(Core::System& system) {
 
 static ResultCode MapSharedMemory(Core::System& system, Handle shared_memory_handle, VAddr addr,
                                   u64 size, u32 permissions) {
-    std::lock_guard lock{HLE::g_hle_lock};
     LOG_TRACE(Kernel_SVC,
               "called, shared_memory_handle=0x{:X}, addr=0x{:X}, size=0x{:X}, permissions=0x{:08X}",
               shared_memory_handle, addr, size, permissions);
@@ -1288,7 +1280,6 @@ static ResultCode MapSharedMemory32(Core::System& system, Handle shared_memory_h
 static ResultCode QueryProcessMemory(Core::System& system, VAddr memory_info_address,
                                      VAddr page_info_address, Handle process_handle,
                                      VAddr address) {
-    std::lock_guard lock{HLE::g_hle_lock};
     LOG_TRACE(Kernel_SVC, "called process=0x{:08X} address={:X}", process_handle, address);
     const auto& handle_table = system.Kernel().CurrentProcess()->GetHandleTable();
     std::shared_ptr<Process> process = handle_table.Get<Process>(process_handle);
@@ -1698,7 +1689,7 @@ static ResultCode WaitProcessWideKeyAtomic(Core::System& system, VAddr mutex_add
         current_thread->SetMutexWaitAddress(mutex_addr);
         current_thread->SetWaitHandle(thread_handle);
         current_thread->SetStatus(ThreadStatus::WaitCondVar);
-        current_process->InsertConditionVariableThread(SharedFrom(current_thread));
+        current_process->InsertConditionVariableThread(current_thread);
     }
 
     if (event_handle != InvalidHandle) {
@@ -1714,7 +1705,7 @@ static ResultCode WaitProcessWideKeyAtomic(Core::System& system, VAddr mutex_add
             owner->RemoveMutexWaiter(SharedFrom(current_thread));
         }
 
-        current_process->RemoveConditionVariableThread(SharedFrom(current_thread));
+        current_process->RemoveConditionVariableThread(current_thread);
     }
     // Note: Deliberately don't attempt to inherit the lock owner's priority.
 
@@ -1738,21 +1729,19 @@ static void SignalProcessWideKey(Core::System& system, VAddr condition_variable_
 
     ASSERT(condition_variable_addr == Common::AlignDown(condition_variable_addr, 4));
 
-    // Retrieve a list of all threads that are waiting for this condition variable.
     auto& kernel = system.Kernel();
     SchedulerLock lock(kernel);
     auto* const current_process = kernel.CurrentProcess();
-    std::vector<std::shared_ptr<Thread>> waiting_threads =
-        current_process->GetConditionVariableThreads(condition_variable_addr);
 
     // Only process up to 'target' threads, unless 'target' is less equal 0, in which case process
     // them all.
-    std::size_t last = waiting_threads.size();
-    if (target > 0) {
-        last = std::min(waiting_threads.size(), static_cast<std::size_t>(target));
-    }
-    for (std::size_t index = 0; index < last; ++index) {
-        auto& thread = waiting_threads[index];
+    for (s32 num_signaled = 0; target <= 0 || num_signaled < target; ++num_signaled) {
+        // Take the highest priority thread that is waiting for this condition variable.
+        Thread* const thread =
+            current_process->GetFirstConditionVariableThread(condition_variable_addr);
+        if (thread == nullptr) {
+            break;
+        }
 
         ASSERT(thread->GetCondVarWaitAddress() == condition_variable_addr);
 
@@ -1781,7 +1770,7 @@ static void SignalProcessWideKey(Core::System& system, VAddr condition_variable_
             // We were able to acquire the mutex, resume this thread.
             auto* const lock_owner = thread->GetLockOwner();
             if (lock_owner != nullptr) {
-                lock_owner->RemoveMutexWaiter(thread);
+                lock_owner->RemoveMutexWaiter(SharedFrom(thread));
             }
 
             thread->SetLockOwner(nullptr);
@@ -1797,7 +1786,7 @@ static void SignalProcessWideKey(Core::System& system, VAddr condition_variable_
                 thread->SetStatus(ThreadStatus::WaitMutex);
             }
 
-            owner->AddMutexWaiter(thread);
+            owner->AddMutexWaiter(SharedFrom(thread));
         }
     }
 }
@@ -1937,7 +1926,6 @@ static ResultCode ResetSignal32(Core::System& system, Handle handle) {
 /// Creates a TransferMemory object
 static ResultCode CreateTransferMemory(Core::System& system, Handle* handle, VAddr addr, u64 size,
                                        u32 permissions) {
-    std::lock_guard lock{HLE::g_hle_lock};
     LOG_DEBUG(Kernel_SVC, "called addr=0x{:X}, size=0x{:X}, perms=0x{:08X}", addr, size,
               permissions);
 
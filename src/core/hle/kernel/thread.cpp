@@ -24,6 +24,7 @@
 #include "core/hle/kernel/process.h"
 #include "core/hle/kernel/scheduler.h"
 #include "core/hle/kernel/thread.h"
+#include "core/hle/kernel/thread_wait_queue.h"
 #include "core/hle/kernel/time_manager.h"
 #include "core/hle/result.h"
 #include "core/memory.h"
@@ -48,7 +49,11 @@ void Thread::Acquire(Thread* thread) {
 }
 
 Thread::Thread(KernelCore& kernel) : SynchronizationObject{kernel} {}
-Thread::~Thread() = default;
+Thread::~Thread() {
+    if (wait_queue != nullptr) {
+        wait_queue->Remove(this);
+    }
+}
 
 void Thread::Stop() {
     {
@@ -366,13 +371,13 @@ void Thread::UpdatePriority() {
     }
 
     if (GetStatus() == ThreadStatus::WaitCondVar) {
-        owner_process->RemoveConditionVariableThread(SharedFrom(this));
+        owner_process->RemoveConditionVariableThread(this);
     }
 
     SetCurrentPriority(new_priority);
 
     if (GetStatus() == ThreadStatus::WaitCondVar) {
-        owner_process->InsertConditionVariableThread(SharedFrom(this));
+        owner_process->InsertConditionVariableThread(this);
     }
 
     if (!lock_owner) {
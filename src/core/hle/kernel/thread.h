@@ -31,6 +31,7 @@ class GlobalScheduler;
 class KernelCore;
 class Process;
 class Scheduler;
+class ThreadWaitQueue;
 
 enum ThreadPriority : u32 {
     THREADPRIO_HIGHEST = 0,            ///< Highest thread priority
@@ -576,6 +577,7 @@ public:
 private:
     friend class GlobalScheduler;
     friend class Scheduler;
+    friend class ThreadWaitQueue;
 
     void SetSchedulingStatus(ThreadSchedStatus new_status);
     void AddSchedulingFlag(ThreadSchedFlags flag);
@@ -644,6 +646,12 @@ private:
     VAddr arb_wait_address{0};
     bool waiting_for_arbitration{};
 
+    /// Intrusive links of the address arbiter or condition variable queue this thread waits in.
+    ThreadWaitQueue* wait_queue = nullptr;
+    Thread* wait_queue_prev = nullptr;
+    Thread* wait_queue_next = nullptr;
+    VAddr wait_queue_key = 0;
+
     /// Handle used as userdata to reference this object when inserting into the CoreTiming queue.
     Handle global_handle = 0;
 
@@ -0,0 +1,110 @@
+// Copyright 2020 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "common/assert.h"
+#include "core/hle/kernel/thread.h"
+#include "core/hle/kernel/thread_wait_queue.h"
+
+namespace Kernel {
+
+ThreadWaitQueue::ThreadWaitQueue() = default;
+
+ThreadWaitQueue::~ThreadWaitQueue() {
+    // Unlink remaining threads so they don't reference a dead queue
+    for (Thread* head : buckets) {
+        while (head != nullptr) {
+            Thread* const next = head->wait_queue_next;
+            head->wait_queue = nullptr;
+            head->wait_queue_prev = nullptr;
+            head->wait_queue_next = nullptr;
+            head = next;
+        }
+    }
+}
+
+void ThreadWaitQueue::Insert(Thread* thread, VAddr address) {
+    ASSERT(thread->wait_queue == nullptr);
+
+    Thread*& head = buckets[BucketIndex(address)];
+    const u32 priority = thread->GetPriority();
+
+    Thread* prev = nullptr;
+    Thread* next = head;
+    while (next != nullptr && next->GetPriority() <= priority) {
+        prev = next;
+        next = next->wait_queue_next;
+    }
+
+    thread->wait_queue = this;
+    thread->wait_queue_key = address;
+    thread->wait_queue_prev = prev;
+    thread->wait_queue_next = next;
+    if (prev != nullptr) {
+        prev->wait_queue_next = thread;
+    } else {
+        head = thread;
+    }
+    if (next != nullptr) {
+        next->wait_queue_prev = thread;
+    }
+    ++num_waiters;
+}
+
+void ThreadWaitQueue::Remove(Thread* thread) {
+    if (thread->wait_queue != this) {
+        return;
+    }
+
+    Thread* const prev = thread->wait_queue_prev;
+    Thread* const next = thread->wait_queue_next;
+    if (prev != nullptr) {
+        prev->wait_queue_next = next;
+    } else {
+        buckets[BucketIndex(thread->wait_queue_key)] = next;
+    }
+    if (next != nullptr) {
+        next->wait_queue_prev = prev;
+    }
+
+    thread->wait_queue = nullptr;
+    thread->wait_queue_prev = nullptr;
+    thread->wait_queue_next = nullptr;
+    --num_waiters;
+}
+
+Thread* ThreadWaitQueue::Front(VAddr address) const {
+    return FindFrom(buckets[BucketIndex(address)], address);
+}
+
+Thread* ThreadWaitQueue::Next(const Thread* thread) const {
+    ASSERT(thread->wait_queue == this);
+    return FindFrom(thread->wait_queue_next, thread->wait_queue_key);
+}
+
+std::size_t ThreadWaitQueue::Count(VAddr address, std::size_t max_count) const {
+    std::size_t count = 0;
+    for (Thread* thread = Front(address); thread != nullptr && count < max_count;
+         thread = Next(thread)) {
+        ++count;
+    }
+    return count;
+}
+
+bool ThreadWaitQueue::Empty() const {
+    return num_waiters == 0;
+}
+
+std::size_t ThreadWaitQueue::BucketIndex(VAddr address) {
+    // Fibonacci hashing, waited addresses are at least word aligned
+    return static_cast<std::size_t>(((address >> 2) * 0x9E3779B97F4A7C15ULL) >> 56);
+}
+
+Thread* ThreadWaitQueue::FindFrom(Thread* thread, VAddr address) {
+    while (thread != nullptr && thread->wait_queue_key != address) {
+        thread = thread->wait_queue_next;
+    }
+    return thread;
+}
+
+} // namespace Kernel
@@ -0,0 +1,67 @@
+// Copyright 2020 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace Kernel {
+
+class Thread;
+
+/**
+ * Priority ordered queue of threads waiting on guest addresses.
+ *
+ * Threads are linked intrusively through nodes embedded in Thread, so waiting and waking never
+ * allocate nor touch reference counts. Addresses are hashed into a fixed set of buckets, each
+ * bucket being a doubly linked list sorted by priority (FIFO among equal priorities). Threads
+ * waiting on different addresses that share a bucket are skipped while iterating.
+ *
+ * All operations have to be performed with the scheduler lock held.
+ */
+class ThreadWaitQueue final {
+public:
+    ThreadWaitQueue();
+    ~ThreadWaitQueue();
+
+    ThreadWaitQueue(const ThreadWaitQueue&) = delete;
+    ThreadWaitQueue& operator=(const ThreadWaitQueue&) = delete;
+
+    ThreadWaitQueue(ThreadWaitQueue&&) = delete;
+    ThreadWaitQueue& operator=(ThreadWaitQueue&&) = delete;
+
+    /// Inserts a thread waiting on the given address. The thread must not be in any queue.
+    void Insert(Thread* thread, VAddr address);
+
+    /// Removes a thread from this queue, does nothing if the thread is not linked to it.
+    void Remove(Thread* thread);
+
+    /// Returns the highest priority thread waiting on an address, or nullptr if there is none.
+    [[nodiscard]] Thread* Front(VAddr address) const;
+
+    /// Returns the next thread waiting on the same address as the given one, or nullptr.
+    [[nodiscard]] Thread* Next(const Thread* thread) const;
+
+    /// Counts the threads waiting on an address, stopping early once max_count is reached.
+    [[nodiscard]] std::size_t Count(VAddr address, std::size_t max_count) const;
+
+    /// Returns true if no thread is waiting on any address.
+    [[nodiscard]] bool Empty() const;
+
+private:
+    static constexpr std::size_t NUM_BUCKETS = 256;
+
+    [[nodiscard]] static std::size_t BucketIndex(VAddr address);
+
+    /// Returns the first thread waiting on an address starting the search from a given thread.
+    [[nodiscard]] static Thread* FindFrom(Thread* thread, VAddr address);
+
+    std::array<Thread*, NUM_BUCKETS> buckets{};
+    std::size_t num_waiters = 0;
+};
+
+} // namespace Kernel
@@ -122,6 +122,7 @@ Controller_NPad::~Controller_NPad() = default;
 void Controller_NPad::InitNewlyAddedController(std::size_t controller_idx) {
     const auto controller_type = connected_controllers[controller_idx].type;
     auto& controller = shared_memory_entries[controller_idx];
+    dirty_entries[controller_idx] = true;
     if (controller_type == NPadControllerType::None) {
         styleset_changed_events[controller_idx].writable->Signal();
         return;
@@ -203,6 +204,7 @@ void Controller_NPad::OnInit() {
         styleset_changed_events[i] = Kernel::WritableEvent::CreateEventPair(
             kernel, fmt::format("npad:NpadStyleSetChanged_{}", i));
     }
+    dirty_entries.fill(true);
 
     if (!IsControllerActivated()) {
         return;
@@ -472,8 +474,7 @@ void Controller_NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing, u8*
 
         press_state |= static_cast<u32>(pad_state.pad_states.raw);
     }
-    std::memcpy(data + NPAD_OFFSET, shared_memory_entries.data(),
-                shared_memory_entries.size() * sizeof(NPadEntry));
+    WriteNPadStates(data);
 }
 
 void Controller_NPad::OnMotionUpdate(const Core::Timing::CoreTiming& core_timing, u8* data,
@@ -597,8 +598,48 @@ void Controller_NPad::OnMotionUpdate(const Core::Timing::CoreTiming& core_timing
             break;
         }
     }
-    std::memcpy(data + NPAD_OFFSET, shared_memory_entries.data(),
-                shared_memory_entries.size() * sizeof(NPadEntry));
+    WriteSixAxisStates(data);
+}
+
+template <typename T>
+void Controller_NPad::WriteToSharedMemory(u8* data, const T& field) const {
+    const auto* const base = reinterpret_cast<const u8*>(shared_memory_entries.data());
+    const auto offset = static_cast<std::size_t>(reinterpret_cast<const u8*>(&field) - base);
+    std::memcpy(data + NPAD_OFFSET + offset, &field, sizeof(T));
+}
+
+void Controller_NPad::WriteNPadStates(u8* data) {
+    for (std::size_t i = 0; i < shared_memory_entries.size(); ++i) {
+        const auto& npad = shared_memory_entries[i];
+        if (dirty_entries[i]) {
+            WriteToSharedMemory(data, npad);
+            dirty_entries[i] = false;
+            continue;
+        }
+        for (const NPadGeneric* states :
+             {&npad.main_controller_states, &npad.handheld_states, &npad.dual_states,
+              &npad.left_joy_states, &npad.right_joy_states, &npad.pokeball_states, &npad.libnx}) {
+            WriteToSharedMemory(data, states->common);
+            WriteToSharedMemory(data, states->npad[states->common.last_entry_index]);
+        }
+    }
+}
+
+void Controller_NPad::WriteSixAxisStates(u8* data) {
+    for (std::size_t i = 0; i < shared_memory_entries.size(); ++i) {
+        const auto& npad = shared_memory_entries[i];
+        if (dirty_entries[i]) {
+            WriteToSharedMemory(data, npad);
+            dirty_entries[i] = false;
+            continue;
+        }
+        for (const SixAxisGeneric* sixaxis :
+             {&npad.sixaxis_full, &npad.sixaxis_handheld, &npad.sixaxis_dual_left,
+              &npad.sixaxis_dual_right, &npad.sixaxis_left, &npad.sixaxis_right}) {
+            WriteToSharedMemory(data, sixaxis->common);
+            WriteToSharedMemory(data, sixaxis->sixaxis[sixaxis->common.last_entry_index]);
+        }
+    }
 }
 
 void Controller_NPad::SetSupportedStyleSet(NPadType style_set) {
@@ -646,6 +687,7 @@ void Controller_NPad::SetNpadMode(u32 npad_id, NPadAssignments assignment_mode)
     ASSERT(npad_index < shared_memory_entries.size());
     if (shared_memory_entries[npad_index].pad_assignment != assignment_mode) {
         shared_memory_entries[npad_index].pad_assignment = assignment_mode;
+        dirty_entries[npad_index] = true;
     }
 }
 
@@ -727,6 +769,7 @@ void Controller_NPad::DisconnectNPadAtIndex(std::size_t npad_index) {
     controller.joy_styles.raw = 0; // Zero out
     controller.device_type.raw = 0;
     controller.properties.raw = 0;
+    dirty_entries[npad_index] = true;
 
     SignalStyleSetChangedEvent(IndexToNPad(npad_index));
 }
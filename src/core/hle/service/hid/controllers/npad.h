@@ -366,10 +366,21 @@ private:
     bool IsControllerSupported(NPadControllerType controller) const;
     void RequestPadStateUpdate(u32 npad_id);
 
+    /// Copies a member of shared_memory_entries to the same location of the shared memory block
+    template <typename T>
+    void WriteToSharedMemory(u8* data, const T& field) const;
+
+    /// Writes the entries marked as dirty to shared memory, otherwise only the headers and latest
+    /// entries of their rings
+    void WriteNPadStates(u8* data);
+    void WriteSixAxisStates(u8* data);
+
     u32 press_state{};
 
     NPadType style{};
     std::array<NPadEntry, 10> shared_memory_entries{};
+    /// Entries modified outside of their rings, these are written to shared memory entirely
+    std::array<bool, 10> dirty_entries{};
     using ButtonArray = std::array<
         std::array<std::unique_ptr<Input::ButtonDevice>, Settings::NativeButton::NUM_BUTTONS_HID>,
         10>;
@@ -4,13 +4,19 @@
 
 #include <algorithm>
 #include <cstring>
+#include <mutex>
+#include <string>
 #include <vector>
 
 #include "common/assert.h"
+#include "common/cityhash.h"
+#include "common/common_funcs.h"
 #include "common/common_paths.h"
 #include "common/common_types.h"
 #include "common/file_util.h"
 #include "common/logging/log.h"
+#include "common/mapped_file.h"
+#include "common/scm_rev.h"
 #include "common/swap.h"
 #include "core/core.h"
 #include "core/file_sys/content_archive.h"
@@ -63,8 +69,7 @@ enum class LoadState : u32 {
     Done = 1,
 };
 
-static void DecryptSharedFont(const std::vector<u32>& input, Kernel::PhysicalMemory& output,
-                              std::size_t& offset) {
+static void DecryptSharedFont(const std::vector<u32>& input, u8* output, std::size_t& offset) {
     ASSERT_MSG(offset + (input.size() * sizeof(u32)) < SHARED_FONT_MEM_SIZE,
                "Shared fonts exceeds 17mb!");
     ASSERT_MSG(input[0] == EXPECTED_MAGIC, "Failed to derive key, unexpected magic number");
@@ -75,8 +80,7 @@ static void DecryptSharedFont(const std::vector<u32>& input, Kernel::PhysicalMem
     std::transform(input.begin(), input.end(), transformed_font.begin(),
                    [&KEY](u32 font_data) { return Common::swap32(font_data ^ KEY); });
     transformed_font[1] = Common::swap32(transformed_font[1]) ^ KEY; // "re-encrypt" the size
-    std::memcpy(output.data() + offset, transformed_font.data(),
-                transformed_font.size() * sizeof(u32));
+    std::memcpy(output + offset, transformed_font.data(), transformed_font.size() * sizeof(u32));
     offset += transformed_font.size() * sizeof(u32);
 }
 
@@ -103,6 +107,22 @@ static u32 GetU32Swapped(const u8* data) {
     return Common::swap32(value);
 }
 
+struct SharedFontCacheHeader {
+    u32_le magic;
+    u32_le version;
+    u64_le source_key;
+    u32_le num_regions;
+    u32_le data_size;
+};
+static_assert(sizeof(SharedFontCacheHeader) == 0x18, "SharedFontCacheHeader has incorrect size.");
+
+constexpr u32 SHARED_FONT_CACHE_MAGIC = Common::MakeMagic('Y', 'S', 'F', 'C');
+constexpr u32 SHARED_FONT_CACHE_VERSION = 1;
+
+static std::string GetSharedFontCachePath() {
+    return Common::FS::GetUserPath(Common::FS::UserPath::CacheDir) + SHARED_FONT;
+}
+
 struct PL_U::Impl {
     const FontRegion& GetSharedFontRegion(std::size_t index) const {
         if (index >= shared_font_regions.size() || shared_font_regions.empty()) {
@@ -131,14 +151,136 @@ struct PL_U::Impl {
         }
     }
 
+    /// Decodes the shared fonts into the font shared memory the first time they are needed
+    void EnsureLoaded(Core::System& system) {
+        std::call_once(load_flag, [this, &system] { LoadSharedFonts(system); });
+    }
+
+    /// Returns a key identifying where each shared font is read from
+    static u64 GetFontSourceKey(const FileSys::RegisteredCache& nand) {
+        std::string sources = Common::g_scm_rev;
+        for (const auto& font : SHARED_FONTS) {
+            const auto nca =
+                nand.GetEntryRaw(static_cast<u64>(font.first), FileSys::ContentRecordType::Data);
+            if (nca) {
+                sources += fmt::format(":{}:{}", nca->GetName(), nca->GetSize());
+            } else {
+                sources += ":synthesized";
+            }
+        }
+        return Common::CityHash64(sources.data(), sources.size());
+    }
+
+    /// Restores the decoded fonts from the cache file, returns false if it is missing or stale
+    bool LoadCache(u8* output, u64 source_key) {
+        const Common::MappedFile file(GetSharedFontCachePath());
+        if (!file.IsOpen() || file.Size() < sizeof(SharedFontCacheHeader)) {
+            return false;
+        }
+        SharedFontCacheHeader header;
+        std::memcpy(&header, file.Data(), sizeof(header));
+        const std::size_t regions_size = header.num_regions * sizeof(FontRegion);
+        if (header.magic != SHARED_FONT_CACHE_MAGIC ||
+            header.version != SHARED_FONT_CACHE_VERSION || header.source_key != source_key ||
+            header.data_size > SHARED_FONT_MEM_SIZE ||
+            file.Size() != sizeof(header) + regions_size + header.data_size) {
+            return false;
+        }
+        const u8* const regions = file.Data() + sizeof(header);
+        shared_font_regions.resize(header.num_regions);
+        std::memcpy(shared_font_regions.data(), regions, regions_size);
+        std::memcpy(output, regions + regions_size, header.data_size);
+        return true;
+    }
+
+    void SaveCache(const u8* data, std::size_t data_size, u64 source_key) const {
+        const std::string path = GetSharedFontCachePath();
+        if (!Common::FS::CreateFullPath(path)) {
+            return;
+        }
+        Common::FS::IOFile file(path, "wb");
+        const SharedFontCacheHeader header{
+            .magic = SHARED_FONT_CACHE_MAGIC,
+            .version = SHARED_FONT_CACHE_VERSION,
+            .source_key = source_key,
+            .num_regions = static_cast<u32>(shared_font_regions.size()),
+            .data_size = static_cast<u32>(data_size),
+        };
+        if (file.WriteObject(header) != 1 ||
+            file.WriteArray(shared_font_regions.data(), shared_font_regions.size()) !=
+                shared_font_regions.size() ||
+            file.WriteBytes(data, data_size) != data_size) {
+            LOG_WARNING(Service_NS, "Failed to write shared font cache");
+            file.Close();
+            Common::FS::Delete(path);
+        }
+    }
+
+    void LoadSharedFonts(Core::System& system) {
+        // Fonts are decoded in place, the shared memory is what the guest maps
+        u8* const output = system.Kernel().GetFontSharedMem().GetPointer();
+
+        const auto* nand = system.GetFileSystemController().GetSystemNANDContents();
+        const u64 source_key = GetFontSourceKey(*nand);
+        if (LoadCache(output, source_key)) {
+            return;
+        }
+
+        // Rebuild shared fonts from data ncas or synthesize
+        std::size_t offset = 0;
+        for (auto font : SHARED_FONTS) {
+            FileSys::VirtualFile romfs;
+            const auto nca =
+                nand->GetEntry(static_cast<u64>(font.first), FileSys::ContentRecordType::Data);
+            if (nca) {
+                romfs = nca->GetRomFS();
+            }
+
+            if (!romfs) {
+                romfs =
+                    FileSys::SystemArchive::SynthesizeSystemArchive(static_cast<u64>(font.first));
+            }
+
+            if (!romfs) {
+                LOG_ERROR(Service_NS, "Failed to find or synthesize {:016X}! Skipping",
+                          static_cast<u64>(font.first));
+                continue;
+            }
+
+            const auto extracted_romfs = FileSys::ExtractRomFS(romfs);
+            if (!extracted_romfs) {
+                LOG_ERROR(Service_NS, "Failed to extract RomFS for {:016X}! Skipping",
+                          static_cast<u64>(font.first));
+                continue;
+            }
+            const auto font_fp = extracted_romfs->GetFile(font.second);
+            if (!font_fp) {
+                LOG_ERROR(Service_NS, "{:016X} has no file \"{}\"! Skipping",
+                          static_cast<u64>(font.first), font.second);
+                continue;
+            }
+            std::vector<u32> font_data_u32(font_fp->GetSize() / sizeof(u32));
+            font_fp->ReadBytes<u32>(font_data_u32.data(), font_fp->GetSize());
+            // We need to be BigEndian as u32s for the xor encryption
+            std::transform(font_data_u32.begin(), font_data_u32.end(), font_data_u32.begin(),
+                           Common::swap32);
+            // Font offset and size do not account for the header
+            const FontRegion region{static_cast<u32>(offset + 8),
+                                    static_cast<u32>((font_data_u32.size() * sizeof(u32)) - 8)};
+            DecryptSharedFont(font_data_u32, output, offset);
+            shared_font_regions.push_back(region);
+        }
+
+        SaveCache(output, offset, source_key);
+    }
+
     /// Handle to shared memory region designated for a shared font
     std::shared_ptr<Kernel::SharedMemory> shared_font_mem;
 
-    /// Backing memory for the shared font data
-    std::shared_ptr<Kernel::PhysicalMemory> shared_font;
-
     // Automatically populated based on shared_fonts dump or system archives.
     std::vector<FontRegion> shared_font_regions;
+
+    std::once_flag load_flag;
 };
 
 PL_U::PL_U(Core::System& system)
@@ -160,56 +302,6 @@ PL_U::PL_U(Core::System& system)
     };
     // clang-format on
     RegisterHandlers(functions);
-
-    auto& fsc = system.GetFileSystemController();
-
-    // Attempt to load shared font data from disk
-    const auto* nand = fsc.GetSystemNANDContents();
-    std::size_t offset = 0;
-    // Rebuild shared fonts from data ncas or synthesize
-
-    impl->shared_font = std::make_shared<Kernel::PhysicalMemory>(SHARED_FONT_MEM_SIZE);
-    for (auto font : SHARED_FONTS) {
-        FileSys::VirtualFile romfs;
-        const auto nca =
-            nand->GetEntry(static_cast<u64>(font.first), FileSys::ContentRecordType::Data);
-        if (nca) {
-            romfs = nca->GetRomFS();
-        }
-
-        if (!romfs) {
-            romfs = FileSys::SystemArchive::SynthesizeSystemArchive(static_cast<u64>(font.first));
-        }
-
-        if (!romfs) {
-            LOG_ERROR(Service_NS, "Failed to find or synthesize {:016X}! Skipping",
-                      static_cast<u64>(font.first));
-            continue;
-        }
-
-        const auto extracted_romfs = FileSys::ExtractRomFS(romfs);
-        if (!extracted_romfs) {
-            LOG_ERROR(Service_NS, "Failed to extract RomFS for {:016X}! Skipping",
-                      static_cast<u64>(font.first));
-            continue;
-        }
-        const auto font_fp = extracted_romfs->GetFile(font.second);
-        if (!font_fp) {
-            LOG_ERROR(Service_NS, "{:016X} has no file \"{}\"! Skipping",
-                      static_cast<u64>(font.first), font.second);
-            continue;
-        }
-        std::vector<u32> font_data_u32(font_fp->GetSize() / sizeof(u32));
-        font_fp->ReadBytes<u32>(font_data_u32.data(), font_fp->GetSize());
-        // We need to be BigEndian as u32s for the xor encryption
-        std::transform(font_data_u32.begin(), font_data_u32.end(), font_data_u32.begin(),
-                       Common::swap32);
-        // Font offset and size do not account for the header
-        const FontRegion region{static_cast<u32>(offset + 8),
-                                static_cast<u32>((font_data_u32.size() * sizeof(u32)) - 8)};
-        DecryptSharedFont(font_data_u32, *impl->shared_font, offset);
-        impl->shared_font_regions.push_back(region);
-    }
 }
 
 PL_U::~PL_U() = default;
@@ -220,6 +312,8 @@ void PL_U::RequestLoad(Kernel::HLERequestContext& ctx) {
     // Games don't call this so all fonts should be loaded
     LOG_DEBUG(Service_NS, "called, shared_font_type={}", shared_font_type);
 
+    impl->EnsureLoaded(system);
+
     IPC::ResponseBuilder rb{ctx, 2};
     rb.Push(RESULT_SUCCESS);
 }
@@ -239,6 +333,8 @@ void PL_U::GetSize(Kernel::HLERequestContext& ctx) {
     const u32 font_id{rp.Pop<u32>()};
     LOG_DEBUG(Service_NS, "called, font_id={}", font_id);
 
+    impl->EnsureLoaded(system);
+
     IPC::ResponseBuilder rb{ctx, 3};
     rb.Push(RESULT_SUCCESS);
     rb.Push<u32>(impl->GetSharedFontRegion(font_id).size);
@@ -249,6 +345,8 @@ void PL_U::GetSharedMemoryAddressOffset(Kernel::HLERequestContext& ctx) {
     const u32 font_id{rp.Pop<u32>()};
     LOG_DEBUG(Service_NS, "called, font_id={}", font_id);
 
+    impl->EnsureLoaded(system);
+
     IPC::ResponseBuilder rb{ctx, 3};
     rb.Push(RESULT_SUCCESS);
     rb.Push<u32>(impl->GetSharedFontRegion(font_id).offset);
@@ -258,13 +356,11 @@ void PL_U::GetSharedMemoryNativeHandle(Kernel::HLERequestContext& ctx) {
     // Map backing memory for the font data
     LOG_DEBUG(Service_NS, "called");
 
-    // Create shared font memory object
+    // The fonts are decoded directly into the shared memory object
+    impl->EnsureLoaded(system);
     auto& kernel = system.Kernel();
     impl->shared_font_mem = SharedFrom(&kernel.GetFontSharedMem());
 
-    std::memcpy(impl->shared_font_mem->GetPointer(), impl->shared_font->data(),
-                impl->shared_font->size());
-
     IPC::ResponseBuilder rb{ctx, 2, 1};
     rb.Push(RESULT_SUCCESS);
     rb.PushCopyObjects(impl->shared_font_mem);
@@ -275,6 +371,8 @@ void PL_U::GetSharedFontInOrderOfPriority(Kernel::HLERequestContext& ctx) {
     const u64 language_code{rp.Pop<u64>()}; // TODO(ogniK): Find out what this is used for
     LOG_DEBUG(Service_NS, "called, language_code={:X}", language_code);
 
+    impl->EnsureLoaded(system);
+
     IPC::ResponseBuilder rb{ctx, 4};
     std::vector<u32> font_codes;
     std::vector<u32> font_offsets;
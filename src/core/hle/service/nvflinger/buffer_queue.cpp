@@ -130,6 +130,28 @@ std::optional<std::reference_wrapper<const BufferQueue::Buffer>> BufferQueue::Ac
     return *itr;
 }
 
+u32 BufferQueue::DropStaleBuffers() {
+    u32 num_dropped = 0;
+    while (queue_sequence.size() > 1) {
+        const u32 slot = queue_sequence.front();
+        queue_sequence.pop_front();
+        const auto itr = std::find_if(queue.begin(), queue.end(), [slot](const Buffer& buffer) {
+            return buffer.status == Buffer::Status::Queued && buffer.slot == slot;
+        });
+        if (itr == queue.end()) {
+            continue;
+        }
+        // The fences of the dropped buffer are kept, the guest waits on them once dequeued
+        itr->status = Buffer::Status::Free;
+        free_buffers.push_back(slot);
+        ++num_dropped;
+    }
+    if (num_dropped > 0) {
+        buffer_wait_event.writable->Signal();
+    }
+    return num_dropped;
+}
+
 void BufferQueue::ReleaseBuffer(u32 slot) {
     auto itr = std::find_if(queue.begin(), queue.end(),
                             [&](const Buffer& buffer) { return buffer.slot == slot; });
@@ -97,6 +97,8 @@ public:
                      Service::Nvidia::MultiFence& multi_fence);
     void CancelBuffer(u32 slot, const Service::Nvidia::MultiFence& multi_fence);
     std::optional<std::reference_wrapper<const Buffer>> AcquireBuffer();
+    /// Frees every queued buffer except the most recent one, returns the number of freed buffers
+    u32 DropStaleBuffers();
     void ReleaseBuffer(u32 slot);
     void Disconnect();
     u32 Query(QueryType type);
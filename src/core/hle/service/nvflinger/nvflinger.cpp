@@ -65,7 +65,10 @@ NVFlinger::NVFlinger(Core::System& system) : system(system) {
     displays.emplace_back(4, "Null", system);
     guard = std::make_shared<std::mutex>();
 
-    // Schedule the screen composition events
+    // Schedule the screen composition events. In single core mode the event runs on the emulated
+    // timeline, which does not advance while Compose blocks on GPU fences, so the fixed interval
+    // is already measured from the end of composition and host pacing is left to the frame
+    // limiter. Only the multicore vsync thread runs on walltime and subtracts the compose time.
     composition_event = Core::Timing::CreateEvent(
         "ScreenComposition", [this](std::uintptr_t, std::chrono::nanoseconds ns_late) {
             const auto guard = Lock();
@@ -233,6 +236,13 @@ void NVFlinger::Compose() {
         VI::Layer& layer = display.GetLayer(0);
         auto& buffer_queue = layer.GetBufferQueue();
 
+        // In low latency mode only the newest queued frame is presented, older ones are dropped
+        if (Settings::values.use_low_latency_presentation.GetValue()) {
+            if (const u32 num_dropped = buffer_queue.DropStaleBuffers(); num_dropped > 0) {
+                system.GetPerfStats().DropGameFrames(num_dropped);
+            }
+        }
+
         // Search for a queued buffer and acquire it
         auto buffer = buffer_queue.AcquireBuffer();
 
@@ -245,10 +255,12 @@ void NVFlinger::Compose() {
         auto& gpu = system.GPU();
         const auto& multi_fence = buffer->get().multi_fence;
         guard->unlock();
+        const auto wait_begin = Core::PerfStats::Clock::now();
         for (u32 fence_id = 0; fence_id < multi_fence.num_fences; fence_id++) {
             const auto& fence = multi_fence.fences[fence_id];
             gpu.WaitFence(fence.id, fence.value);
         }
+        system.GetPerfStats().AddGPUWaitTime(Core::PerfStats::Clock::now() - wait_begin);
         guard->lock();
 
         MicroProfileFlip();
@@ -90,11 +90,20 @@ namespace Service {
 }
 
 ServiceFrameworkBase::ServiceFrameworkBase(const char* service_name, u32 max_sessions,
+                                           ServiceThreadType thread_type,
                                            InvokerFn* handler_invoker)
-    : service_name(service_name), max_sessions(max_sessions), handler_invoker(handler_invoker) {}
+    : service_name(service_name), max_sessions(max_sessions), thread_type(thread_type),
+      handler_invoker(handler_invoker) {}
 
 ServiceFrameworkBase::~ServiceFrameworkBase() = default;
 
+std::string ServiceFrameworkBase::GetServiceThreadName() const {
+    if (thread_type == ServiceThreadType::CreateNew) {
+        return service_name;
+    }
+    return {};
+}
+
 void ServiceFrameworkBase::InstallAsService(SM::ServiceManager& service_manager) {
     ASSERT(!port_installed);
 
@@ -130,6 +139,40 @@ void ServiceFrameworkBase::RegisterHandlersBase(const FunctionInfoBase* function
         // Usually this array is sorted by id already, so hint to insert at the end
         handlers.emplace_hint(handlers.cend(), functions[i].expected_header, functions[i]);
     }
+    BuildDispatchTable();
+}
+
+void ServiceFrameworkBase::BuildDispatchTable() {
+    dispatch_table.clear();
+    if (handlers.empty()) {
+        return;
+    }
+
+    const u32 first_id = handlers.begin()->first;
+    const u32 last_id = handlers.rbegin()->first;
+    const std::size_t span = static_cast<std::size_t>(last_id - first_id) + 1;
+
+    // Services with sparse command ids (e.g. 0, 10100, 20100) keep using the binary search
+    if (span > handlers.size() * 4 + 16) {
+        return;
+    }
+
+    dispatch_base = first_id;
+    dispatch_table.assign(span, nullptr);
+    for (const auto& [id, info] : handlers) {
+        dispatch_table[id - first_id] = &info;
+    }
+}
+
+const ServiceFrameworkBase::FunctionInfoBase* ServiceFrameworkBase::FindHandler(
+    u32 command) const {
+    if (!dispatch_table.empty()) {
+        // Ids below the base wrap around and fail the bounds check
+        const u32 index = command - dispatch_base;
+        return index < dispatch_table.size() ? dispatch_table[index] : nullptr;
+    }
+    const auto itr = handlers.find(command);
+    return itr == handlers.end() ? nullptr : &itr->second;
 }
 
 void ServiceFrameworkBase::ReportUnimplementedFunction(Kernel::HLERequestContext& ctx,
@@ -151,8 +194,7 @@ void ServiceFrameworkBase::ReportUnimplementedFunction(Kernel::HLERequestContext
 }
 
 void ServiceFrameworkBase::InvokeRequest(Kernel::HLERequestContext& ctx) {
-    auto itr = handlers.find(ctx.GetCommand());
-    const FunctionInfoBase* info = itr == handlers.end() ? nullptr : &itr->second;
+    const FunctionInfoBase* info = FindHandler(ctx.GetCommand());
     if (info == nullptr || info->handler_callback == nullptr) {
         return ReportUnimplementedFunction(ctx, info);
     }
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 #include <boost/container/flat_map.hpp>
 #include "common/common_types.h"
 #include "core/hle/kernel/hle_ipc.h"
@@ -45,6 +46,15 @@ static const u32 DefaultMaxSessions = 10;
  *
  * @see ServiceFramework
  */
+/// Host thread the requests of a service are executed on in multicore mode.
+enum class ServiceThreadType {
+    /// Core timing thread, serialized with every other service and with core timing events.
+    Default,
+    /// Dedicated thread. Only for services whose state is not reachable from other services or
+    /// from core timing events, the interfaces they open are executed on the same thread.
+    CreateNew,
+};
+
 class ServiceFrameworkBase : public Kernel::SessionRequestHandler {
 public:
     /// Returns the string identifier used to connect to the service.
@@ -71,6 +81,8 @@ public:
 
     ResultCode HandleSyncRequest(Kernel::HLERequestContext& context) override;
 
+    std::string GetServiceThreadName() const override;
+
 protected:
     /// Member-function pointer type of SyncRequest handlers.
     template <typename Self>
@@ -89,16 +101,24 @@ private:
     using InvokerFn = void(ServiceFrameworkBase* object, HandlerFnP<ServiceFrameworkBase> member,
                            Kernel::HLERequestContext& ctx);
 
-    ServiceFrameworkBase(const char* service_name, u32 max_sessions, InvokerFn* handler_invoker);
+    ServiceFrameworkBase(const char* service_name, u32 max_sessions, ServiceThreadType thread_type,
+                         InvokerFn* handler_invoker);
     ~ServiceFrameworkBase() override;
 
     void RegisterHandlersBase(const FunctionInfoBase* functions, std::size_t n);
     void ReportUnimplementedFunction(Kernel::HLERequestContext& ctx, const FunctionInfoBase* info);
 
+    /// Rebuilds the direct lookup table after the registered handlers changed.
+    void BuildDispatchTable();
+    /// Returns the handler of a command id, or nullptr if there is none.
+    const FunctionInfoBase* FindHandler(u32 command) const;
+
     /// Identifier string used to connect to the service.
     std::string service_name;
     /// Maximum number of concurrent sessions that this service can handle.
     u32 max_sessions;
+    /// Host thread the requests of this service are executed on.
+    ServiceThreadType thread_type;
 
     /// Flag to store if a port was already create/installed to detect multiple install attempts,
     /// which is not supported.
@@ -107,6 +127,10 @@ private:
     /// Function used to safely up-cast pointers to the derived class before invoking a handler.
     InvokerFn* handler_invoker;
     boost::container::flat_map<u32, FunctionInfoBase> handlers;
+
+    /// Handlers indexed by command id minus dispatch_base, empty when ids are too sparse.
+    std::vector<const FunctionInfoBase*> dispatch_table;
+    u32 dispatch_base = 0;
 };
 
 /**
@@ -149,9 +173,11 @@ protected:
      * Initializes the handler with no functions installed.
      * @param max_sessions Maximum number of sessions that can be
      * connected to this service at the same time.
+     * @param thread_type Host thread the requests of this service are executed on.
      */
-    explicit ServiceFramework(const char* service_name, u32 max_sessions = DefaultMaxSessions)
-        : ServiceFrameworkBase(service_name, max_sessions, Invoker) {}
+    explicit ServiceFramework(const char* service_name, u32 max_sessions = DefaultMaxSessions,
+                              ServiceThreadType thread_type = ServiceThreadType::Default)
+        : ServiceFrameworkBase(service_name, max_sessions, thread_type, Invoker) {}
 
     /// Registers handlers in the service.
     template <std::size_t N>
@@ -37,6 +37,32 @@ bool IsConnectionBased(Type type) {
 
 } // Anonymous namespace
 
+s32 BSD::PollWork::Interest(BSD* bsd, std::vector<Network::PollFD>& interests) {
+    if (nfds <= 0 || timeout < -1 || write_buffer.size() < nfds * sizeof(PollFD)) {
+        return 0;
+    }
+
+    const size_t length = std::min(read_buffer.size(), write_buffer.size());
+    std::vector<PollFD> fds(nfds);
+    std::memcpy(fds.data(), read_buffer.data(), length);
+
+    for (const PollFD& pollfd : fds) {
+        if (!bsd->IsFileDescriptorValid(pollfd.fd)) {
+            // Let PollImpl report the invalid entry without waiting
+            interests.clear();
+            return 0;
+        }
+        interests.push_back(Network::PollFD{
+            .socket = bsd->file_descriptors[pollfd.fd]->socket.get(),
+            .events = TranslatePollEventsToHost(pollfd.events),
+            .revents = 0,
+        });
+    }
+
+    // The reactor executes the poll once a socket is ready or the deadline expires
+    return std::exchange(timeout, 0);
+}
+
 void BSD::PollWork::Execute(BSD* bsd) {
     std::tie(ret, bsd_errno) = bsd->PollImpl(write_buffer, read_buffer, nfds, timeout);
 }
@@ -50,6 +76,10 @@ void BSD::PollWork::Response(Kernel::HLERequestContext& ctx) {
     rb.PushEnum(bsd_errno);
 }
 
+s32 BSD::AcceptWork::Interest(BSD* bsd, std::vector<Network::PollFD>& interests) {
+    return bsd->SocketInterestImpl(fd, Network::POLL_IN, interests);
+}
+
 void BSD::AcceptWork::Execute(BSD* bsd) {
     std::tie(ret, bsd_errno) = bsd->AcceptImpl(fd, write_buffer);
 }
@@ -75,6 +105,10 @@ void BSD::ConnectWork::Response(Kernel::HLERequestContext& ctx) {
     rb.PushEnum(bsd_errno);
 }
 
+s32 BSD::RecvWork::Interest(BSD* bsd, std::vector<Network::PollFD>& interests) {
+    return bsd->SocketInterestImpl(fd, Network::POLL_IN, interests);
+}
+
 void BSD::RecvWork::Execute(BSD* bsd) {
     std::tie(ret, bsd_errno) = bsd->RecvImpl(fd, flags, message);
 }
@@ -88,6 +122,10 @@ void BSD::RecvWork::Response(Kernel::HLERequestContext& ctx) {
     rb.PushEnum(bsd_errno);
 }
 
+s32 BSD::RecvFromWork::Interest(BSD* bsd, std::vector<Network::PollFD>& interests) {
+    return bsd->SocketInterestImpl(fd, Network::POLL_IN, interests);
+}
+
 void BSD::RecvFromWork::Execute(BSD* bsd) {
     std::tie(ret, bsd_errno) = bsd->RecvFromImpl(fd, flags, message, addr);
 }
@@ -422,6 +460,15 @@ void BSD::ExecuteWork(Kernel::HLERequestContext& ctx, std::string_view sleep_rea
     // This will be overwritten by the SleepClientThread callback
     work.Response(ctx);
 
+    if constexpr (requires(BSD* bsd, std::vector<Network::PollFD>& interests) {
+                      work.Interest(bsd, interests);
+                  }) {
+        if (reactor.IsAvailable()) {
+            reactor.Submit(ctx, sleep_reason, std::move(work));
+            return;
+        }
+    }
+
     auto worker = worker_pool.CaptureWorker();
 
     ctx.SleepClientThread(std::string(sleep_reason), std::numeric_limits<u64>::max(),
@@ -775,14 +822,17 @@ Errno BSD::CloseImpl(s32 fd) {
         return Errno::BADF;
     }
 
-    const Errno bsd_errno = Translate(file_descriptors[fd]->socket->Close());
-    if (bsd_errno != Errno::SUCCESS) {
-        return bsd_errno;
-    }
+    Errno bsd_errno = Errno::SUCCESS;
+    reactor.RemoveSocket(file_descriptors[fd]->socket.get(), [this, fd, &bsd_errno] {
+        bsd_errno = Translate(file_descriptors[fd]->socket->Close());
+        if (bsd_errno != Errno::SUCCESS) {
+            return;
+        }
 
-    LOG_INFO(Service, "Close socket fd={}", fd);
+        LOG_INFO(Service, "Close socket fd={}", fd);
 
-    file_descriptors[fd].reset();
+        file_descriptors[fd].reset();
+    });
     return bsd_errno;
 }
 
@@ -807,6 +857,18 @@ bool BSD::IsFileDescriptorValid(s32 fd) const noexcept {
     return true;
 }
 
+s32 BSD::SocketInterestImpl(s32 fd, u16 events, std::vector<Network::PollFD>& interests) const {
+    if (!IsFileDescriptorValid(fd)) {
+        return 0;
+    }
+    interests.push_back(Network::PollFD{
+        .socket = file_descriptors[fd]->socket.get(),
+        .events = events,
+        .revents = 0,
+    });
+    return -1;
+}
+
 bool BSD::IsBlockingSocket(s32 fd) const noexcept {
     // Inform invalid sockets as non-blocking
     // This way we avoid using a worker thread as it will fail without blocking host
@@ -816,7 +878,7 @@ bool BSD::IsBlockingSocket(s32 fd) const noexcept {
     if (!file_descriptors[fd]) {
         return false;
     }
-    return (file_descriptors[fd]->flags & FLAG_O_NONBLOCK) != 0;
+    return (file_descriptors[fd]->flags & FLAG_O_NONBLOCK) == 0;
 }
 
 void BSD::BuildErrnoResponse(Kernel::HLERequestContext& ctx, Errno bsd_errno) const noexcept {
@@ -828,7 +890,8 @@ void BSD::BuildErrnoResponse(Kernel::HLERequestContext& ctx, Errno bsd_errno) co
 }
 
 BSD::BSD(Core::System& system, const char* name)
-    : ServiceFramework(name), worker_pool{system, this} {
+    : ServiceFramework(name, DefaultMaxSessions, ServiceThreadType::CreateNew),
+      worker_pool{system, this}, reactor{system, this, name} {
     // clang-format off
     static const FunctionInfo functions[] = {
         {0, &BSD::RegisterClient, "RegisterClient"},
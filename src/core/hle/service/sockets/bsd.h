@@ -12,6 +12,7 @@
 #include "core/hle/kernel/hle_ipc.h"
 #include "core/hle/service/service.h"
 #include "core/hle/service/sockets/blocking_worker.h"
+#include "core/hle/service/sockets/socket_reactor.h"
 #include "core/hle/service/sockets/sockets.h"
 
 namespace Core {
@@ -20,6 +21,7 @@ class System;
 
 namespace Network {
 class Socket;
+struct PollFD;
 }
 
 namespace Service::Sockets {
@@ -40,6 +42,7 @@ private:
     };
 
     struct PollWork {
+        s32 Interest(BSD* bsd, std::vector<Network::PollFD>& interests);
         void Execute(BSD* bsd);
         void Response(Kernel::HLERequestContext& ctx);
 
@@ -52,6 +55,7 @@ private:
     };
 
     struct AcceptWork {
+        s32 Interest(BSD* bsd, std::vector<Network::PollFD>& interests);
         void Execute(BSD* bsd);
         void Response(Kernel::HLERequestContext& ctx);
 
@@ -71,6 +75,7 @@ private:
     };
 
     struct RecvWork {
+        s32 Interest(BSD* bsd, std::vector<Network::PollFD>& interests);
         void Execute(BSD* bsd);
         void Response(Kernel::HLERequestContext& ctx);
 
@@ -82,6 +87,7 @@ private:
     };
 
     struct RecvFromWork {
+        s32 Interest(BSD* bsd, std::vector<Network::PollFD>& interests);
         void Execute(BSD* bsd);
         void Response(Kernel::HLERequestContext& ctx);
 
@@ -165,6 +171,9 @@ private:
     bool IsFileDescriptorValid(s32 fd) const noexcept;
     bool IsBlockingSocket(s32 fd) const noexcept;
 
+    /// Appends the socket of fd to interests, returns zero when fd is invalid and -1 otherwise
+    s32 SocketInterestImpl(s32 fd, u16 events, std::vector<Network::PollFD>& interests) const;
+
     void BuildErrnoResponse(Kernel::HLERequestContext& ctx, Errno bsd_errno) const noexcept;
 
     std::array<std::optional<FileDescriptor>, MAX_FD> file_descriptors;
@@ -172,6 +181,8 @@ private:
     BlockingWorkerPool<BSD, PollWork, AcceptWork, ConnectWork, RecvWork, RecvFromWork, SendWork,
                        SendToWork>
         worker_pool;
+
+    SocketReactor<BSD, PollWork, AcceptWork, RecvWork, RecvFromWork> reactor;
 };
 
 class BSDCFG final : public ServiceFramework<BSDCFG> {
@@ -0,0 +1,301 @@
+// Copyright 2020 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/assert.h"
+#include "common/microprofile.h"
+#include "common/thread.h"
+#include "core/core.h"
+#include "core/hle/kernel/hle_ipc.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/thread.h"
+#include "core/hle/kernel/writable_event.h"
+#include "core/network/network.h"
+#include "core/network/sockets.h"
+
+namespace Service::Sockets {
+
+/**
+ * Single host thread that waits on every blocked guest socket operation through a persistent
+ * Network::PollSet. Guest threads sleep on a kernel event until their sockets are ready, then
+ * the operation is executed without blocking and the event is signalled.
+ *
+ * Work types have to implement Interest, appending the sockets and events they wait for and
+ * returning a timeout in milliseconds (-1 for none). Execute must not block once ready, so each
+ * readiness event executes a single work waiting on that socket.
+ *
+ * @tparam Service  Service where the work is executed
+ * @tparam Types Types of work to execute
+ */
+template <class Service, class... Types>
+class SocketReactor {
+    using WorkVariant = std::variant<std::monostate, Types...>;
+    using Clock = std::chrono::steady_clock;
+
+    struct Pending {
+        WorkVariant work;
+        std::vector<Network::PollFD> interests;
+        std::optional<Clock::time_point> deadline;
+        std::shared_ptr<Kernel::WritableEvent> kernel_event;
+        bool is_cancelled = false;
+    };
+
+public:
+    explicit SocketReactor(Core::System& system_, Service* service_, std::string_view name_)
+        : system{system_}, service{service_}, name{name_} {
+        if (poll_set.IsAvailable()) {
+            thread = std::thread([this] { Run(); });
+        }
+    }
+
+    ~SocketReactor() {
+        if (!thread.joinable()) {
+            return;
+        }
+        is_running.store(false, std::memory_order_relaxed);
+        poll_set.Interrupt();
+        thread.join();
+    }
+
+    SocketReactor(const SocketReactor&) = delete;
+    SocketReactor& operator=(const SocketReactor&) = delete;
+
+    /// Returns true when blocking work can be handled by the reactor on this host
+    [[nodiscard]] bool IsAvailable() const noexcept {
+        return thread.joinable();
+    }
+
+    /**
+     * Puts the client thread to sleep until the sockets of the work are ready
+     * Work without sockets to wait on is executed immediately.
+     */
+    template <class Work>
+    void Submit(Kernel::HLERequestContext& ctx, std::string_view sleep_reason, Work work) {
+        Pending* const pending = Acquire();
+        pending->interests.clear();
+        const s32 timeout = work.Interest(service, pending->interests);
+        if (pending->interests.empty() && timeout == 0) {
+            Release(pending);
+            work.Execute(service);
+            work.Response(ctx);
+            return;
+        }
+
+        ctx.SleepClientThread(std::string(sleep_reason), std::numeric_limits<u64>::max(),
+                              Callback<Work>(pending), pending->kernel_event);
+
+        std::scoped_lock lock{mutex};
+        pending->work = std::move(work);
+        pending->is_cancelled = false;
+        pending->deadline.reset();
+        if (timeout >= 0) {
+            pending->deadline = Clock::now() + std::chrono::milliseconds(timeout);
+        }
+        waiting.push_back(pending);
+
+        for (const Network::PollFD& interest : pending->interests) {
+            ArmSocket(interest.socket);
+        }
+        poll_set.Interrupt();
+    }
+
+    /**
+     * Detaches a socket from the reactor and runs close_func while no work can be executed.
+     * Work blocked on the socket is woken up and observes the closed descriptor.
+     */
+    template <typename Func>
+    void RemoveSocket(Network::Socket* socket, Func&& close_func) {
+        if (!IsAvailable()) {
+            close_func();
+            return;
+        }
+        {
+            std::scoped_lock lock{mutex};
+            poll_set.Remove(socket);
+            for (Pending* const pending : waiting) {
+                auto& interests = pending->interests;
+                const auto it = std::remove_if(interests.begin(), interests.end(),
+                                               [socket](const Network::PollFD& interest) {
+                                                   return interest.socket == socket;
+                                               });
+                if (it != interests.end()) {
+                    interests.erase(it, interests.end());
+                    pending->is_cancelled = true;
+                }
+            }
+            close_func();
+        }
+        poll_set.Interrupt();
+    }
+
+private:
+    /// Generate a callback for @see SleepClientThread
+    template <class Work>
+    auto Callback(Pending* pending) {
+        return [this, pending](std::shared_ptr<Kernel::Thread>, Kernel::HLERequestContext& ctx,
+                               Kernel::ThreadWakeupReason reason) {
+            ASSERT(reason == Kernel::ThreadWakeupReason::Signal);
+            std::get<Work>(pending->work).Response(ctx);
+            Release(pending);
+        };
+    }
+
+    Pending* Acquire() {
+        std::scoped_lock lock{mutex};
+        if (!free_list.empty()) {
+            Pending* const pending = free_list.back();
+            free_list.pop_back();
+            return pending;
+        }
+        auto& pending = storage.emplace_back(std::make_unique<Pending>());
+        auto pair = Kernel::WritableEvent::CreateEventPair(
+            system.Kernel(), fmt::format("{}:Reactor:{}", name, storage.size() - 1));
+        pending->kernel_event = std::move(pair.writable);
+        return pending.get();
+    }
+
+    void Release(Pending* pending) {
+        std::scoped_lock lock{mutex};
+        pending->work = std::monostate{};
+        free_list.push_back(pending);
+    }
+
+    /// Re-arms a socket with the union of the events waited by all pending work
+    void ArmSocket(Network::Socket* socket) {
+        std::optional<u16> events;
+        for (const Pending* const pending : waiting) {
+            for (const Network::PollFD& interest : pending->interests) {
+                if (interest.socket == socket) {
+                    events = static_cast<u16>(events.value_or(0) | interest.events);
+                }
+            }
+        }
+        if (events) {
+            poll_set.Arm(socket, *events);
+        }
+    }
+
+    /// Returns the time to wait until the closest deadline, -1 when there is none
+    s32 NextTimeout() {
+        std::scoped_lock lock{mutex};
+        std::optional<Clock::time_point> closest;
+        for (const Pending* const pending : waiting) {
+            if (pending->is_cancelled) {
+                return 0;
+            }
+            if (pending->deadline && (!closest || *pending->deadline < *closest)) {
+                closest = pending->deadline;
+            }
+        }
+        if (!closest) {
+            return -1;
+        }
+        const auto remaining =
+            std::chrono::ceil<std::chrono::milliseconds>(*closest - Clock::now()).count();
+        return static_cast<s32>(std::clamp<s64>(remaining, 0, std::numeric_limits<s32>::max()));
+    }
+
+    /**
+     * Returns true when the work has to be executed. A readiness event wakes at most one work per
+     * socket, the host call of a second waiter could otherwise block the reactor thread once the
+     * first one consumed the data. The sockets of the remaining waiters are re-armed afterwards.
+     */
+    bool TakeReady(const Pending* pending, Clock::time_point now) {
+        if (pending->is_cancelled || (pending->deadline && now >= *pending->deadline)) {
+            return true;
+        }
+        for (const Network::PollFD& interest : pending->interests) {
+            if (std::find(consumed.begin(), consumed.end(), interest.socket) != consumed.end()) {
+                continue;
+            }
+            const u16 mask = interest.events | Network::POLL_ERR | Network::POLL_HUP;
+            for (const Network::PollFD& event : ready) {
+                if (event.socket == interest.socket && (event.revents & mask) != 0) {
+                    consumed.push_back(interest.socket);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void Run() {
+        system.RegisterHostThread();
+
+        const std::string thread_name = fmt::format("yuzu:{}:Reactor", name);
+        MicroProfileOnThreadCreate(thread_name.c_str());
+        Common::SetCurrentThreadName(thread_name.c_str());
+
+        while (is_running.load(std::memory_order_relaxed)) {
+            ready.clear();
+            poll_set.Wait(ready, NextTimeout());
+
+            std::scoped_lock lock{mutex};
+            const Clock::time_point now = Clock::now();
+            consumed.clear();
+            fired.clear();
+
+            // Walk the waiters in submission order so the oldest one takes each event
+            auto it = waiting.begin();
+            for (Pending* const pending : waiting) {
+                if (TakeReady(pending, now)) {
+                    fired.push_back(pending);
+                } else {
+                    *it++ = pending;
+                }
+            }
+            waiting.erase(it, waiting.end());
+
+            for (Pending* const pending : fired) {
+                std::visit(
+                    [this]<typename T>(T& w) {
+                        if constexpr (!std::is_same_v<T, std::monostate>) {
+                            w.Execute(service);
+                        }
+                    },
+                    pending->work);
+                pending->kernel_event->Signal();
+            }
+
+            // One-shot notifications disarm sockets, re-arm the ones still being waited on
+            for (const Network::PollFD& event : ready) {
+                ArmSocket(event.socket);
+            }
+        }
+    }
+
+    Core::System& system;
+    Service* const service;
+    const std::string name;
+
+    Network::PollSet poll_set;
+    std::thread thread;
+    std::atomic_bool is_running{true};
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Pending>> storage;
+    std::vector<Pending*> free_list;
+    std::vector<Pending*> waiting;
+    std::vector<Network::PollFD> ready;
+    std::vector<Network::Socket*> consumed;
+    std::vector<Pending*> fired;
+};
+
+} // namespace Service::Sockets
@@ -7,6 +7,7 @@
 #include "common/common_funcs.h"
 #include "common/file_util.h"
 #include "common/logging/log.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/content_archive.h"
 #include "core/file_sys/control_metadata.h"
@@ -156,26 +157,38 @@ AppLoader_DeconstructedRomDirectory::LoadResult AppLoader_DeconstructedRomDirect
         return {ResultStatus::ErrorUnableToParseKernelMetadata, {}};
     }
 
+    // Decompress all the NSO modules concurrently, then load them in order. The images are
+    // declared before the workers so they outlive any queued work on early returns.
+    std::vector<std::pair<FileSys::VirtualFile, AppLoader_NSO::ModuleImage>> images;
+    {
+        Common::ThreadWorker workers(0, "yuzu:NSOLoader");
+        for (const auto& module : static_modules) {
+            const FileSys::VirtualFile module_file{dir->GetFile(module)};
+            if (!module_file) {
+                continue;
+            }
+
+            const bool should_pass_arguments = std::strcmp(module, "rtld") == 0;
+            auto image =
+                AppLoader_NSO::DecompressModule(*module_file, should_pass_arguments, workers);
+            if (!image) {
+                return {ResultStatus::ErrorLoadingNSO, {}};
+            }
+            images.emplace_back(module_file, std::move(*image));
+        }
+        workers.WaitForRequests();
+    }
+
     // Load NSO modules
     modules.clear();
     const VAddr base_address{process.PageTable().GetCodeRegionStart()};
     VAddr next_load_addr{base_address};
     const FileSys::PatchManager pm{metadata.GetTitleID()};
-    for (const auto& module : static_modules) {
-        const FileSys::VirtualFile module_file{dir->GetFile(module)};
-        if (!module_file) {
-            continue;
-        }
-
+    for (auto& [module_file, image] : images) {
         const VAddr load_addr{next_load_addr};
-        const bool should_pass_arguments = std::strcmp(module, "rtld") == 0;
-        const auto tentative_next_load_addr = AppLoader_NSO::LoadModule(
-            process, system, *module_file, load_addr, should_pass_arguments, true, pm);
-        if (!tentative_next_load_addr) {
-            return {ResultStatus::ErrorLoadingNSO, {}};
-        }
-
-        next_load_addr = *tentative_next_load_addr;
+        const std::string module = module_file->GetName();
+        next_load_addr = AppLoader_NSO::LoadModule(process, system, *module_file,
+                                                   std::move(image), load_addr, pm);
         modules.insert_or_assign(load_addr, module);
         LOG_DEBUG(Loader, "loaded module {} @ 0x{:X}", module, load_addr);
         // Register module with GDBStub
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstring>
 #include <vector>
@@ -12,6 +13,7 @@
 #include "common/logging/log.h"
 #include "common/lz4_compression.h"
 #include "common/swap.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/patch_manager.h"
 #include "core/gdbstub/gdbstub.h"
@@ -35,19 +37,46 @@ struct MODHeader {
 };
 static_assert(sizeof(MODHeader) == 0x1c, "MODHeader has incorrect size.");
 
-std::vector<u8> DecompressSegment(const std::vector<u8>& compressed_data,
-                                  const NSOSegmentHeader& header) {
-    std::vector<u8> uncompressed_data =
-        Common::Compression::DecompressDataLZ4(compressed_data, header.size);
+constexpr u32 PageAlignSize(u32 size) {
+    return static_cast<u32>((size + Core::Memory::PAGE_MASK) & ~Core::Memory::PAGE_MASK);
+}
 
-    ASSERT_MSG(uncompressed_data.size() == header.size, "{} != {}", header.size,
-               uncompressed_data.size());
+std::optional<NSOHeader> ReadHeader(const FileSys::VfsFile& file) {
+    if (file.GetSize() < sizeof(NSOHeader)) {
+        return std::nullopt;
+    }
 
-    return uncompressed_data;
+    NSOHeader nso_header{};
+    if (sizeof(NSOHeader) != file.ReadObject(&nso_header)) {
+        return std::nullopt;
+    }
+
+    if (nso_header.magic != Common::MakeMagic('N', 'S', 'O', '0')) {
+        return std::nullopt;
+    }
+    return nso_header;
 }
 
-constexpr u32 PageAlignSize(u32 size) {
-    return static_cast<u32>((size + Core::Memory::PAGE_MASK) & ~Core::Memory::PAGE_MASK);
+bool PassesArguments(bool should_pass_arguments) {
+    return should_pass_arguments && !Settings::values.program_args.empty();
+}
+
+/// Returns the size of the segments and program arguments in the program image
+u32 GetSegmentsEnd(const NSOHeader& nso_header, bool should_pass_arguments) {
+    u32 end = 0;
+    for (const NSOSegmentHeader& segment : nso_header.segments) {
+        end = std::max(end, segment.location + segment.size);
+    }
+    if (PassesArguments(should_pass_arguments)) {
+        end += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
+    }
+    return end;
+}
+
+/// Returns the page aligned size of the program image, including .bss
+u32 GetImageSize(const NSOHeader& nso_header, bool should_pass_arguments) {
+    return PageAlignSize(GetSegmentsEnd(nso_header, should_pass_arguments) +
+                         nso_header.segments[2].bss_size);
 }
 } // Anonymous namespace
 
@@ -75,64 +104,97 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::Process& process, Core::S
                                                const FileSys::VfsFile& file, VAddr load_base,
                                                bool should_pass_arguments, bool load_into_process,
                                                std::optional<FileSys::PatchManager> pm) {
-    if (file.GetSize() < sizeof(NSOHeader)) {
-        return std::nullopt;
+    // The code layout only depends on the header, avoid decompressing the module to compute it
+    if (!load_into_process) {
+        const std::optional<NSOHeader> nso_header = ReadHeader(file);
+        if (!nso_header) {
+            return std::nullopt;
+        }
+        return load_base + GetImageSize(*nso_header, should_pass_arguments);
     }
 
-    NSOHeader nso_header{};
-    if (sizeof(NSOHeader) != file.ReadObject(&nso_header)) {
+    std::optional<ModuleImage> image;
+    {
+        // One worker per segment
+        Common::ThreadWorker workers(3, "yuzu:NSOLoader");
+        image = DecompressModule(file, should_pass_arguments, workers);
+        workers.WaitForRequests();
+    }
+    if (!image) {
         return std::nullopt;
     }
+    return LoadModule(process, system, file, std::move(*image), load_base, std::move(pm));
+}
 
-    if (nso_header.magic != Common::MakeMagic('N', 'S', 'O', '0')) {
+std::optional<AppLoader_NSO::ModuleImage> AppLoader_NSO::DecompressModule(
+    const FileSys::VfsFile& file, bool should_pass_arguments, Common::ThreadWorker& workers) {
+    const std::optional<NSOHeader> nso_header = ReadHeader(file);
+    if (!nso_header) {
         return std::nullopt;
     }
 
-    // Build program image
-    Kernel::CodeSet codeset;
-    Kernel::PhysicalMemory program_image;
-    for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
-        std::vector<u8> data =
-            file.ReadBytes(nso_header.segments_compressed_size[i], nso_header.segments[i].offset);
-        if (nso_header.IsSegmentCompressed(i)) {
-            data = DecompressSegment(data, nso_header.segments[i]);
+    ModuleImage image;
+    image.header = *nso_header;
+    image.image_size = GetImageSize(*nso_header, should_pass_arguments);
+
+    // Build program image, the segments are decompressed in place. The image is allocated once so
+    // the destination of the queued work stays valid while the image is moved around.
+    Kernel::CodeSet& codeset = image.codeset;
+    Kernel::PhysicalMemory& program_image = codeset.memory;
+    program_image.resize(image.image_size);
+    for (std::size_t i = 0; i < nso_header->segments.size(); ++i) {
+        const NSOSegmentHeader& segment = nso_header->segments[i];
+        u8* const destination = program_image.data() + segment.location;
+        const u32 compressed_size = nso_header->segments_compressed_size[i];
+        if (nso_header->IsSegmentCompressed(i)) {
+            // Reads are kept on this thread, the file layers may not be safe to read concurrently
+            std::vector<u8> data = file.ReadBytes(compressed_size, segment.offset);
+            workers.QueueWork([data = std::move(data), destination, size = segment.size] {
+                const bool success =
+                    Common::Compression::DecompressDataLZ4(data.data(), data.size(), destination,
+                                                           size);
+                ASSERT_MSG(success, "Failed to decompress segment of size {}", size);
+            });
+        } else {
+            file.Read(destination, std::min(compressed_size, segment.size), segment.offset);
         }
-        program_image.resize(nso_header.segments[i].location + static_cast<u32>(data.size()));
-        std::memcpy(program_image.data() + nso_header.segments[i].location, data.data(),
-                    data.size());
-        codeset.segments[i].addr = nso_header.segments[i].location;
-        codeset.segments[i].offset = nso_header.segments[i].location;
-        codeset.segments[i].size = nso_header.segments[i].size;
+        codeset.segments[i].addr = segment.location;
+        codeset.segments[i].offset = segment.location;
+        codeset.segments[i].size = segment.size;
     }
 
-    if (should_pass_arguments && !Settings::values.program_args.empty()) {
+    if (PassesArguments(should_pass_arguments)) {
         const auto arg_data{Settings::values.program_args};
 
         codeset.DataSegment().size += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
         NSOArgumentHeader args_header{
             NSO_ARGUMENT_DATA_ALLOCATION_SIZE, static_cast<u32_le>(arg_data.size()), {}};
-        const auto end_offset = program_image.size();
-        program_image.resize(static_cast<u32>(program_image.size()) +
-                             NSO_ARGUMENT_DATA_ALLOCATION_SIZE);
+        const auto end_offset = GetSegmentsEnd(*nso_header, false);
         std::memcpy(program_image.data() + end_offset, &args_header, sizeof(NSOArgumentHeader));
         std::memcpy(program_image.data() + end_offset + sizeof(NSOArgumentHeader), arg_data.data(),
                     arg_data.size());
     }
 
-    codeset.DataSegment().size += nso_header.segments[2].bss_size;
-    const u32 image_size{
-        PageAlignSize(static_cast<u32>(program_image.size()) + nso_header.segments[2].bss_size)};
-    program_image.resize(image_size);
+    codeset.DataSegment().size += nso_header->segments[2].bss_size;
 
-    for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
+    for (std::size_t i = 0; i < nso_header->segments.size(); ++i) {
         codeset.segments[i].size = PageAlignSize(codeset.segments[i].size);
     }
 
+    return image;
+}
+
+VAddr AppLoader_NSO::LoadModule(Kernel::Process& process, Core::System& system,
+                                const FileSys::VfsFile& file, ModuleImage image, VAddr load_base,
+                                std::optional<FileSys::PatchManager> pm) {
+    const NSOHeader& nso_header = image.header;
+    Kernel::PhysicalMemory& program_image = image.codeset.memory;
+
     // Apply patches if necessary
     if (pm && (pm->HasNSOPatch(nso_header.build_id) || Settings::values.dump_nso)) {
         std::vector<u8> pi_header;
-        pi_header.insert(pi_header.begin(), reinterpret_cast<u8*>(&nso_header),
-                         reinterpret_cast<u8*>(&nso_header) + sizeof(NSOHeader));
+        pi_header.insert(pi_header.begin(), reinterpret_cast<const u8*>(&nso_header),
+                         reinterpret_cast<const u8*>(&nso_header) + sizeof(NSOHeader));
         pi_header.insert(pi_header.begin() + sizeof(NSOHeader), program_image.data(),
                          program_image.data() + program_image.size());
 
@@ -141,23 +203,18 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::Process& process, Core::S
         std::copy(pi_header.begin() + sizeof(NSOHeader), pi_header.end(), program_image.data());
     }
 
-    // If we aren't actually loading (i.e. just computing the process code layout), we are done
-    if (!load_into_process) {
-        return load_base + image_size;
-    }
-
     // Apply cheats if they exist and the program has a valid title ID
     if (pm) {
         system.SetCurrentProcessBuildID(nso_header.build_id);
         const auto cheats = pm->CreateCheatList(system, nso_header.build_id);
         if (!cheats.empty()) {
-            system.RegisterCheatList(cheats, nso_header.build_id, load_base, image_size);
+            system.RegisterCheatList(cheats, nso_header.build_id, load_base, image.image_size);
         }
     }
 
     // Load codeset for current process
-    codeset.memory = std::move(program_image);
-    process.LoadModule(std::move(codeset), load_base);
+    const u32 image_size = image.image_size;
+    process.LoadModule(std::move(image.codeset), load_base);
 
     // Register module with GDBStub
     GDBStub::RegisterModule(file.GetName(), load_base, load_base);
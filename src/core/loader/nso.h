@@ -10,8 +10,13 @@
 #include "common/common_types.h"
 #include "common/swap.h"
 #include "core/file_sys/patch_manager.h"
+#include "core/hle/kernel/code_set.h"
 #include "core/loader/loader.h"
 
+namespace Common {
+class ThreadWorker;
+}
+
 namespace Core {
 class System;
 }
@@ -71,6 +76,13 @@ static_assert(sizeof(NSOArgumentHeader) == 0x20, "NSOArgumentHeader has incorrec
 /// Loads an NSO file
 class AppLoader_NSO final : public AppLoader {
 public:
+    /// Program image of a module whose segments are decompressed by a worker pool
+    struct ModuleImage {
+        NSOHeader header{};
+        Kernel::CodeSet codeset;
+        u32 image_size{};
+    };
+
     explicit AppLoader_NSO(FileSys::VirtualFile file);
 
     /**
@@ -89,6 +101,26 @@ public:
                                            bool should_pass_arguments, bool load_into_process,
                                            std::optional<FileSys::PatchManager> pm = {});
 
+    /**
+     * Reads the segments of a module and queues their decompression into its program image.
+     * The image must not be loaded before the workers have finished their requests.
+     * @param file NSO file of the module
+     * @param should_pass_arguments Whether the program arguments are appended to the image
+     * @param workers Worker pool decompressing the segments
+     * @return The program image, or std::nullopt if the module is invalid
+     */
+    static std::optional<ModuleImage> DecompressModule(const FileSys::VfsFile& file,
+                                                       bool should_pass_arguments,
+                                                       Common::ThreadWorker& workers);
+
+    /**
+     * Patches a decompressed module and loads it into the process
+     * @return The address following the loaded module
+     */
+    static VAddr LoadModule(Kernel::Process& process, Core::System& system,
+                            const FileSys::VfsFile& file, ModuleImage image, VAddr load_base,
+                            std::optional<FileSys::PatchManager> pm = {});
+
     LoadResult Load(Kernel::Process& process, Core::System& system) override;
 
     ResultStatus ReadNSOModules(Modules& modules) override;
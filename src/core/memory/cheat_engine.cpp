@@ -4,6 +4,7 @@
 
 #include <locale>
 #include "common/hex_util.h"
+#include "common/logging/backend.h"
 #include "common/microprofile.h"
 #include "common/swap.h"
 #include "core/core.h"
@@ -75,6 +76,10 @@ void StandardVmCallbacks::CommandLog(std::string_view data) {
               data.back() == '\n' ? data.substr(0, data.size() - 1) : data);
 }
 
+bool StandardVmCallbacks::IsCommandLogEnabled() const {
+    return Log::IsEnabled(Log::Class::CheatEngine, Log::Level::Debug);
+}
+
 VAddr StandardVmCallbacks::SanitizeAddress(VAddr in) const {
     if ((in < metadata.main_nso_extents.base ||
          in >= metadata.main_nso_extents.base + metadata.main_nso_extents.size) &&
@@ -644,23 +644,10 @@ bool DmntCheatVm::DecodeNextOpcode(CheatVmOpcode& out) {
 void DmntCheatVm::SkipConditionalBlock() {
     if (condition_depth > 0) {
         // We want to continue until we're out of the current block.
-        const std::size_t desired_depth = condition_depth - 1;
-
-        CheatVmOpcode skip_opcode{};
-        while (condition_depth > desired_depth && DecodeNextOpcode(skip_opcode)) {
-            // Decode instructions until we see end of the current conditional block.
-            // NOTE: This is broken in gateway's implementation.
-            // Gateway currently checks for "0x2" instead of "0x20000000"
-            // In addition, they do a linear scan instead of correctly decoding opcodes.
-            // This causes issues if "0x2" appears as an immediate in the conditional block...
-
-            // We also support nesting of conditional blocks, and Gateway does not.
-            if (skip_opcode.begin_conditional_block) {
-                condition_depth++;
-            } else if (std::holds_alternative<EndConditionalOpcode>(skip_opcode.opcode)) {
-                condition_depth--;
-            }
-        }
+        // The matching end of every block was resolved when the program was compiled, nested
+        // blocks included. Blocks without an end run until the end of the program.
+        condition_depth--;
+        instruction_ptr = block_ends[instruction_ptr - 1];
     } else {
         // Skipping, but condition_depth = 0.
         // This is an error condition.
@@ -671,6 +658,39 @@ void DmntCheatVm::SkipConditionalBlock() {
     }
 }
 
+void DmntCheatVm::CompileProgram() {
+    compiled_program.clear();
+    block_ends.clear();
+
+    instruction_ptr = 0;
+    decode_success = true;
+
+    // Decode until the end of the program or the first invalid opcode, which stops execution.
+    CheatVmOpcode opcode{};
+    while (DecodeNextOpcode(opcode)) {
+        compiled_program.push_back(opcode);
+    }
+
+    // Match conditional blocks the same way a linear skip would, supporting nesting.
+    // NOTE: This is broken in gateway's implementation.
+    // Gateway currently checks for "0x2" instead of "0x20000000"
+    // In addition, they do a linear scan instead of correctly decoding opcodes.
+    // This causes issues if "0x2" appears as an immediate in the conditional block...
+    block_ends.assign(compiled_program.size(), compiled_program.size());
+    std::vector<std::size_t> open_blocks;
+    for (std::size_t i = 0; i < compiled_program.size(); ++i) {
+        if (compiled_program[i].begin_conditional_block) {
+            open_blocks.push_back(i);
+        } else if (std::holds_alternative<EndConditionalOpcode>(compiled_program[i].opcode) &&
+                   !open_blocks.empty()) {
+            block_ends[open_blocks.back()] = i + 1;
+            open_blocks.pop_back();
+        }
+    }
+
+    instruction_ptr = 0;
+}
+
 u64 DmntCheatVm::GetVmInt(VmInt value, u32 bit_width) {
     switch (bit_width) {
     case 1:
@@ -717,6 +737,7 @@ bool DmntCheatVm::LoadProgram(const std::vector<CheatEntry>& entries) {
             // Bounds check.
             if (entries[i].definition.num_opcodes + num_opcodes > MaximumProgramOpcodeCount) {
                 num_opcodes = 0;
+                CompileProgram();
                 return false;
             }
 
@@ -726,36 +747,45 @@ bool DmntCheatVm::LoadProgram(const std::vector<CheatEntry>& entries) {
         }
     }
 
+    CompileProgram();
     return true;
 }
 
 void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
-    CheatVmOpcode cur_opcode{};
-
     // Get Keys down.
     u64 kDown = callbacks->HidKeysDown();
 
-    callbacks->CommandLog("Started VM execution.");
-    callbacks->CommandLog(fmt::format("Main NSO:  {:012X}", metadata.main_nso_extents.base));
-    callbacks->CommandLog(fmt::format("Heap:      {:012X}", metadata.main_nso_extents.base));
-    callbacks->CommandLog(fmt::format("Keys Down: {:08X}", static_cast<u32>(kDown & 0x0FFFFFFF)));
+    // Formatting the trace is far more expensive than executing the program itself.
+    const bool log_commands = callbacks->IsCommandLogEnabled();
+    if (log_commands) {
+        callbacks->CommandLog("Started VM execution.");
+        callbacks->CommandLog(fmt::format("Main NSO:  {:012X}", metadata.main_nso_extents.base));
+        callbacks->CommandLog(fmt::format("Heap:      {:012X}", metadata.main_nso_extents.base));
+        callbacks->CommandLog(
+            fmt::format("Keys Down: {:08X}", static_cast<u32>(kDown & 0x0FFFFFFF)));
+    }
 
     // Clear VM state.
     ResetState();
 
     // Loop until program finishes.
-    while (DecodeNextOpcode(cur_opcode)) {
-        callbacks->CommandLog(
-            fmt::format("Instruction Ptr: {:04X}", static_cast<u32>(instruction_ptr)));
+    while (instruction_ptr < compiled_program.size()) {
+        const CheatVmOpcode& cur_opcode = compiled_program[instruction_ptr++];
 
-        for (std::size_t i = 0; i < NumRegisters; i++) {
-            callbacks->CommandLog(fmt::format("Registers[{:02X}]: {:016X}", i, registers[i]));
-        }
+        if (log_commands) {
+            callbacks->CommandLog(
+                fmt::format("Instruction Ptr: {:04X}", static_cast<u32>(instruction_ptr)));
 
-        for (std::size_t i = 0; i < NumRegisters; i++) {
-            callbacks->CommandLog(fmt::format("SavedRegs[{:02X}]: {:016X}", i, saved_values[i]));
+            for (std::size_t i = 0; i < NumRegisters; i++) {
+                callbacks->CommandLog(fmt::format("Registers[{:02X}]: {:016X}", i, registers[i]));
+            }
+
+            for (std::size_t i = 0; i < NumRegisters; i++) {
+                callbacks->CommandLog(
+                    fmt::format("SavedRegs[{:02X}]: {:016X}", i, saved_values[i]));
+            }
+            LogOpcode(cur_opcode);
         }
-        LogOpcode(cur_opcode);
 
         // Increment conditional depth, if relevant.
         if (cur_opcode.begin_conditional_block) {
@@ -781,7 +811,7 @@ void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
             u64 src_address =
                 GetCheatProcessAddress(metadata, begin_cond->mem_type, begin_cond->rel_address);
             u64 src_value = 0;
-            switch (store_static->bit_width) {
+            switch (begin_cond->bit_width) {
             case 1:
             case 2:
             case 4:
@@ -284,6 +284,9 @@ public:
 
         virtual void DebugLog(u8 id, u64 value) = 0;
         virtual void CommandLog(std::string_view data) = 0;
+
+        /// Returns true when CommandLog output is consumed, skipping the VM trace otherwise
+        virtual bool IsCommandLogEnabled() const = 0;
     };
 
     static constexpr std::size_t MaximumProgramOpcodeCount = 0x400;
@@ -311,12 +314,17 @@ private:
     std::size_t condition_depth = 0;
     bool decode_success = false;
     std::array<u32, MaximumProgramOpcodeCount> program{};
+    // Program decoded once at load time, executed every frame without re-decoding.
+    std::vector<CheatVmOpcode> compiled_program;
+    // Index past the matching end of each conditional block, used to skip blocks in O(1).
+    std::vector<std::size_t> block_ends;
     std::array<u64, NumRegisters> registers{};
     std::array<u64, NumRegisters> saved_values{};
     std::array<u64, NumStaticRegisters> static_registers{};
     std::array<std::size_t, NumRegisters> loop_tops{};
 
     bool DecodeNextOpcode(CheatVmOpcode& out);
+    void CompileProgram();
     void SkipConditionalBlock();
     void ResetState();
 
@@ -19,6 +19,10 @@
 #include <poll.h>
 #include <sys/socket.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
 #else
 #error "Unimplemented platform"
 #endif
@@ -167,7 +171,7 @@ int LastError() {
 }
 
 bool EnableNonBlock(int fd, bool enable) {
-    int flags = fcntl(fd, F_GETFD);
+    int flags = fcntl(fd, F_GETFL);
     if (flags == -1) {
         return false;
     }
@@ -176,9 +180,44 @@ bool EnableNonBlock(int fd, bool enable) {
     } else {
         flags &= ~O_NONBLOCK;
     }
-    return fcntl(fd, F_SETFD, flags) == 0;
+    return fcntl(fd, F_SETFL, flags) == 0;
+}
+
+#ifdef __linux__
+
+u32 TranslateEpollEvents(u16 events) {
+    u32 result = 0;
+    if ((events & POLL_IN) != 0) {
+        result |= EPOLLIN;
+    }
+    if ((events & POLL_PRI) != 0) {
+        result |= EPOLLPRI;
+    }
+    if ((events & POLL_OUT) != 0) {
+        result |= EPOLLOUT;
+    }
+    return result;
+}
+
+u16 TranslateEpollRevents(u32 revents) {
+    u16 result = 0;
+    const auto translate = [&result, revents](u32 host, u16 guest) {
+        if ((revents & host) != 0) {
+            result |= guest;
+        }
+    };
+
+    translate(EPOLLIN, POLL_IN);
+    translate(EPOLLPRI, POLL_PRI);
+    translate(EPOLLOUT, POLL_OUT);
+    translate(EPOLLERR, POLL_ERR);
+    translate(EPOLLHUP, POLL_HUP);
+
+    return result;
 }
 
+#endif // __linux__
+
 #endif
 
 int TranslateDomain(Domain domain) {
@@ -364,6 +403,122 @@ std::pair<s32, Errno> Poll(std::vector<PollFD>& pollfds, s32 timeout) {
     return {-1, Errno::SUCCESS};
 }
 
+PollSet::PollSet() {
+#ifdef __linux__
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd == -1) {
+        LOG_ERROR(Network, "epoll_create1 failed with errno={}", errno);
+        return;
+    }
+    event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (event_fd == -1) {
+        LOG_ERROR(Network, "eventfd failed with errno={}", errno);
+        close(std::exchange(epoll_fd, -1));
+        return;
+    }
+    // The interrupt event is the only entry without a socket attached
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.ptr = nullptr;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, event_fd, &event) == -1) {
+        LOG_ERROR(Network, "Failed to register interrupt event errno={}", errno);
+        close(std::exchange(event_fd, -1));
+        close(std::exchange(epoll_fd, -1));
+    }
+#endif
+}
+
+PollSet::~PollSet() {
+#ifdef __linux__
+    if (event_fd != -1) {
+        close(event_fd);
+    }
+    if (epoll_fd != -1) {
+        close(epoll_fd);
+    }
+#endif
+}
+
+bool PollSet::IsAvailable() const noexcept {
+    return epoll_fd != -1;
+}
+
+Errno PollSet::Arm(Socket* socket, u16 events) {
+#ifdef __linux__
+    epoll_event event{};
+    event.events = TranslateEpollEvents(events) | EPOLLONESHOT;
+    event.data.ptr = socket;
+
+    // Sockets stay registered after their first wait, so re-arming is the common case
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_MOD, socket->fd, &event) == 0) {
+        return Errno::SUCCESS;
+    }
+    if (errno == ENOENT && epoll_ctl(epoll_fd, EPOLL_CTL_ADD, socket->fd, &event) == 0) {
+        return Errno::SUCCESS;
+    }
+    switch (const int ec = LastError()) {
+    case EBADF:
+        return Errno::BADF;
+    default:
+        UNREACHABLE_MSG("Unhandled host socket error={}", ec);
+        return Errno::SUCCESS;
+    }
+#else
+    UNREACHABLE_MSG("Poll sets are not available on this platform");
+    return Errno::SUCCESS;
+#endif
+}
+
+void PollSet::Remove(Socket* socket) {
+#ifdef __linux__
+    // Sockets that were never armed are not registered, ENOENT is expected in that case
+    (void)epoll_ctl(epoll_fd, EPOLL_CTL_DEL, socket->fd, nullptr);
+#endif
+}
+
+void PollSet::Interrupt() {
+#ifdef __linux__
+    const u64 value = 1;
+    (void)write(event_fd, &value, sizeof(value));
+#endif
+}
+
+std::pair<s32, Errno> PollSet::Wait(std::vector<PollFD>& ready, s32 timeout) {
+#ifdef __linux__
+    std::array<epoll_event, 64> events;
+    const int result =
+        epoll_wait(epoll_fd, events.data(), static_cast<int>(events.size()), timeout);
+    if (result == -1) {
+        if (errno == EINTR) {
+            return {0, Errno::SUCCESS};
+        }
+        const int ec = LastError();
+        UNREACHABLE_MSG("Unhandled host socket error={}", ec);
+        return {-1, Errno::SUCCESS};
+    }
+
+    s32 num_ready = 0;
+    for (int i = 0; i < result; ++i) {
+        const epoll_event& event = events[i];
+        if (event.data.ptr == nullptr) {
+            u64 value;
+            (void)read(event_fd, &value, sizeof(value));
+            continue;
+        }
+        ready.push_back(PollFD{
+            .socket = static_cast<Socket*>(event.data.ptr),
+            .events = 0,
+            .revents = TranslateEpollRevents(event.events),
+        });
+        ++num_ready;
+    }
+    return {num_ready, Errno::SUCCESS};
+#else
+    UNREACHABLE_MSG("Poll sets are not available on this platform");
+    return {-1, Errno::SUCCESS};
+#endif
+}
+
 Socket::~Socket() {
     if (fd == INVALID_SOCKET) {
         return;
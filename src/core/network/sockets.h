@@ -91,4 +91,42 @@ public:
 
 std::pair<s32, Errno> Poll(std::vector<PollFD>& poll_fds, s32 timeout);
 
+/**
+ * Persistent set of sockets waited on through a single host object (epoll on Linux).
+ * Sockets are registered once and re-armed for one-shot notifications, avoiding the translation
+ * of the whole descriptor list on every wait.
+ */
+class PollSet {
+public:
+    explicit PollSet();
+    ~PollSet();
+
+    PollSet(const PollSet&) = delete;
+    PollSet& operator=(const PollSet&) = delete;
+
+    /// Returns true when the host supports persistent poll sets
+    [[nodiscard]] bool IsAvailable() const noexcept;
+
+    /// Arms a one-shot notification for the given events, registering the socket if needed
+    Errno Arm(Socket* socket, u16 events);
+
+    /// Removes a socket from the set, this has to be called before the socket is closed
+    void Remove(Socket* socket);
+
+    /// Wakes up a thread blocked on Wait
+    void Interrupt();
+
+    /**
+     * Waits for armed sockets to become ready
+     * @param ready   Ready sockets are appended here with their returned events
+     * @param timeout Timeout in milliseconds, -1 waits indefinitely
+     * @returns Number of ready sockets appended and an error code
+     */
+    std::pair<s32, Errno> Wait(std::vector<PollFD>& ready, s32 timeout);
+
+private:
+    int epoll_fd = -1;
+    int event_fd = -1;
+};
+
 } // namespace Network
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iterator>
 #include <mutex>
 #include <numeric>
@@ -66,6 +67,11 @@ void PerfStats::EndSystemFrame() {
 
     previous_frame_length = frame_end - previous_frame_end;
     previous_frame_end = frame_end;
+
+    const double frame_length = duration_cast<DoubleSecs>(previous_frame_length).count();
+    accumulated_frame_length += frame_length;
+    accumulated_frame_length_sq += frame_length * frame_length;
+    max_frame_length = std::max(max_frame_length, previous_frame_length);
 }
 
 void PerfStats::EndGameFrame() {
@@ -74,6 +80,19 @@ void PerfStats::EndGameFrame() {
     game_frames += 1;
 }
 
+void PerfStats::DropGameFrames(u32 count) {
+    std::lock_guard lock{object_mutex};
+
+    game_frames += count;
+    dropped_frames += count;
+}
+
+void PerfStats::AddGPUWaitTime(Clock::duration wait_time) {
+    std::lock_guard lock{object_mutex};
+
+    accumulated_gpu_wait += wait_time;
+}
+
 double PerfStats::GetMeanFrametime() const {
     std::lock_guard lock{object_mutex};
 
@@ -95,12 +114,21 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
 
     const auto system_us_per_second = (current_system_time_us - reset_point_system_us) / interval;
 
+    const double frames = static_cast<double>(system_frames);
+    const double mean_frame_length = accumulated_frame_length / frames;
+    const double frame_length_variance =
+        accumulated_frame_length_sq / frames - mean_frame_length * mean_frame_length;
+
     const PerfStatsResults results{
         .system_fps = static_cast<double>(system_frames) / interval,
         .game_fps = static_cast<double>(game_frames) / interval,
         .frametime = duration_cast<DoubleSecs>(accumulated_frametime).count() /
                      static_cast<double>(system_frames),
         .emulation_speed = system_us_per_second.count() / 1'000'000.0,
+        .frame_pacing_jitter = std::sqrt(std::max(frame_length_variance, 0.0)),
+        .max_frame_interval = duration_cast<DoubleSecs>(max_frame_length).count(),
+        .gpu_wait_time = duration_cast<DoubleSecs>(accumulated_gpu_wait).count() / frames,
+        .dropped_frames = dropped_frames,
     };
 
     // Reset counters
@@ -109,6 +137,11 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     accumulated_frametime = Clock::duration::zero();
     system_frames = 0;
     game_frames = 0;
+    dropped_frames = 0;
+    accumulated_gpu_wait = Clock::duration::zero();
+    accumulated_frame_length = 0.0;
+    accumulated_frame_length_sq = 0.0;
+    max_frame_length = Clock::duration::zero();
 
     return results;
 }
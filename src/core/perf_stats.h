@@ -21,6 +21,15 @@ struct PerfStatsResults {
     double frametime;
     /// Ratio of walltime / emulated time elapsed
     double emulation_speed;
+    /// Standard deviation of the walltime between presented system frames, in seconds
+    double frame_pacing_jitter;
+    /// Longest walltime between two presented system frames, in seconds
+    double max_frame_interval;
+    /// Walltime per system frame spent waiting for the GPU to finish the presented buffer, in
+    /// seconds
+    double gpu_wait_time;
+    /// Game frames discarded without being presented
+    u32 dropped_frames;
 };
 
 /**
@@ -37,6 +46,8 @@ public:
     void BeginSystemFrame();
     void EndSystemFrame();
     void EndGameFrame();
+    void DropGameFrames(u32 count);
+    void AddGPUWaitTime(Clock::duration wait_time);
 
     PerfStatsResults GetAndResetStats(std::chrono::microseconds current_system_time_us);
 
@@ -73,6 +84,16 @@ private:
     u32 system_frames = 0;
     /// Cumulative number of game frames (GSP frame submissions) since last reset
     u32 game_frames = 0;
+    /// Cumulative number of game frames discarded before presentation since last reset
+    u32 dropped_frames = 0;
+    /// Cumulative duration spent waiting for the GPU to finish presented buffers since last reset
+    Clock::duration accumulated_gpu_wait = Clock::duration::zero();
+    /// Sum of the walltime between presented system frames since last reset, in seconds
+    double accumulated_frame_length = 0.0;
+    /// Sum of the squared walltime between presented system frames since last reset, in seconds
+    double accumulated_frame_length_sq = 0.0;
+    /// Longest walltime between presented system frames since last reset
+    Clock::duration max_frame_length = Clock::duration::zero();
 
     /// Point when the previous system frame ended
     Clock::time_point previous_frame_end = reset_point;
@@ -19,6 +19,7 @@ namespace Settings {
 enum class RendererBackend {
     OpenGL = 0,
     Vulkan = 1,
+    Null = 2,
 };
 
 enum class GPUAccuracy : u32 {
@@ -116,6 +117,8 @@ struct Values {
     Setting<bool> use_assembly_shaders;
     Setting<bool> use_asynchronous_shaders;
     Setting<bool> use_fast_gpu_time;
+    Setting<bool> use_low_latency_presentation;
+    Setting<bool> use_accelerated_texture_decoding;
 
     Setting<float> bg_red;
     Setting<float> bg_green;
@@ -181,6 +184,7 @@ struct Values {
     bool reporting_services;
     bool quest_flag;
     bool disable_macro_jit;
+    bool capture_gpu_trace;
 
     // Misceallaneous
     std::string log_filter;
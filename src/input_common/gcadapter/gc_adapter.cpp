@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <chrono>
+#include <cstring>
 #include <thread>
 
 #ifdef _MSC_VER
@@ -41,22 +42,21 @@ Adapter::~Adapter() {
 
 void Adapter::AdapterInputThread() {
     LOG_DEBUG(Input, "GC Adapter input thread started");
-    s32 payload_size{};
-    AdapterPayload adapter_payload{};
 
     if (adapter_scan_thread.joinable()) {
         adapter_scan_thread.join();
     }
 
-    while (adapter_input_thread_running) {
-        libusb_interrupt_transfer(usb_adapter_handle, input_endpoint, adapter_payload.data(),
-                                  static_cast<s32>(adapter_payload.size()), &payload_size, 16);
-        if (IsPayloadCorrect(adapter_payload, payload_size)) {
-            UpdateControllers(adapter_payload);
-            UpdateVibrations();
+    // Transfers complete from libusb_handle_events, the callbacks run on this thread
+    if (SubmitTransfers()) {
+        while (adapter_input_thread_running) {
+            timeval timeout{0, 16000};
+            libusb_handle_events_timeout_completed(libusb_ctx, &timeout, nullptr);
         }
-        std::this_thread::yield();
+    } else {
+        restart_scan_thread = true;
     }
+    CancelTransfers();
 
     if (restart_scan_thread) {
         adapter_scan_thread = std::thread(&Adapter::AdapterScanThread, this);
@@ -64,6 +64,95 @@ void Adapter::AdapterInputThread() {
     }
 }
 
+bool Adapter::SubmitTransfers() {
+    constexpr auto input_callback = [](libusb_transfer* transfer) {
+        static_cast<Adapter*>(transfer->user_data)->OnInputTransfer(transfer);
+    };
+    constexpr auto output_callback = [](libusb_transfer* transfer) {
+        static_cast<Adapter*>(transfer->user_data)->OnOutputTransfer(transfer);
+    };
+
+    output_transfer = libusb_alloc_transfer(0);
+    if (!output_transfer) {
+        return false;
+    }
+    libusb_fill_interrupt_transfer(output_transfer, usb_adapter_handle, output_endpoint,
+                                   output_payload.data(), static_cast<s32>(output_payload.size()),
+                                   output_callback, this, 16);
+
+    for (std::size_t i = 0; i < input_transfers.size(); ++i) {
+        libusb_transfer* const transfer = libusb_alloc_transfer(0);
+        if (!transfer) {
+            return false;
+        }
+        input_transfers[i] = transfer;
+        libusb_fill_interrupt_transfer(transfer, usb_adapter_handle, input_endpoint,
+                                       input_payloads[i].data(),
+                                       static_cast<s32>(input_payloads[i].size()),
+                                       input_callback, this, 16);
+        const int err = libusb_submit_transfer(transfer);
+        if (err) {
+            LOG_ERROR(Input, "Adapter libusb submit failed: {}", libusb_error_name(err));
+            return false;
+        }
+        ++input_transfers_in_flight;
+    }
+    return true;
+}
+
+void Adapter::CancelTransfers() {
+    for (libusb_transfer* const transfer : input_transfers) {
+        if (transfer) {
+            libusb_cancel_transfer(transfer);
+        }
+    }
+    if (output_in_flight) {
+        libusb_cancel_transfer(output_transfer);
+    }
+    // Cancelled transfers still complete through their callbacks
+    while (input_transfers_in_flight > 0 || output_in_flight) {
+        timeval timeout{0, 16000};
+        libusb_handle_events_timeout_completed(libusb_ctx, &timeout, nullptr);
+    }
+    for (libusb_transfer*& transfer : input_transfers) {
+        libusb_free_transfer(transfer);
+        transfer = nullptr;
+    }
+    libusb_free_transfer(output_transfer);
+    output_transfer = nullptr;
+}
+
+void Adapter::OnInputTransfer(libusb_transfer* transfer) {
+    --input_transfers_in_flight;
+    if (transfer->status == LIBUSB_TRANSFER_CANCELLED) {
+        return;
+    }
+
+    AdapterPayload adapter_payload{};
+    const s32 payload_size =
+        transfer->status == LIBUSB_TRANSFER_COMPLETED ? transfer->actual_length : 0;
+    std::memcpy(adapter_payload.data(), transfer->buffer,
+                std::min<std::size_t>(payload_size, adapter_payload.size()));
+    if (IsPayloadCorrect(adapter_payload, payload_size)) {
+        UpdateControllers(adapter_payload);
+        UpdateVibrations();
+    }
+
+    if (!adapter_input_thread_running) {
+        return;
+    }
+    const int err = libusb_submit_transfer(transfer);
+    if (err) {
+        LOG_ERROR(Input, "Adapter libusb submit failed: {}", libusb_error_name(err));
+        if (input_transfers_in_flight == 0) {
+            adapter_input_thread_running = false;
+            restart_scan_thread = true;
+        }
+        return;
+    }
+    ++input_transfers_in_flight;
+}
+
 bool Adapter::IsPayloadCorrect(const AdapterPayload& adapter_payload, s32 payload_size) {
     if (payload_size != static_cast<s32>(adapter_payload.size()) ||
         adapter_payload[0] != LIBUSB_DT_HID) {
@@ -123,22 +212,22 @@ void Adapter::UpdateStateButtons(std::size_t port, u8 b1, u8 b2) {
         PadButton::TriggerR,
         PadButton::TriggerL,
     };
-    pads[port].buttons = 0;
+    // Accumulate locally so readers never observe a partially updated state
+    u16 buttons = 0;
     for (std::size_t i = 0; i < b1_buttons.size(); ++i) {
         if ((b1 & (1U << i)) != 0) {
-            pads[port].buttons =
-                static_cast<u16>(pads[port].buttons | static_cast<u16>(b1_buttons[i]));
+            buttons = static_cast<u16>(buttons | static_cast<u16>(b1_buttons[i]));
             pads[port].last_button = b1_buttons[i];
         }
     }
 
     for (std::size_t j = 0; j < b2_buttons.size(); ++j) {
         if ((b2 & (1U << j)) != 0) {
-            pads[port].buttons =
-                static_cast<u16>(pads[port].buttons | static_cast<u16>(b2_buttons[j]));
+            buttons = static_cast<u16>(buttons | static_cast<u16>(b2_buttons[j]));
             pads[port].last_button = b2_buttons[j];
         }
     }
+    pads[port].buttons.store(buttons, std::memory_order_relaxed);
 }
 
 void Adapter::UpdateStateAxes(std::size_t port, const AdapterPayload& adapter_payload) {
@@ -158,8 +247,9 @@ void Adapter::UpdateStateAxes(std::size_t port, const AdapterPayload& adapter_pa
         if (pads[port].axis_origin[index] == 255) {
             pads[port].axis_origin[index] = axis_value;
         }
-        pads[port].axis_values[index] =
-            static_cast<s16>(axis_value - pads[port].axis_origin[index]);
+        pads[port].axis_values[index].store(
+            static_cast<s16>(axis_value - pads[port].axis_origin[index]),
+            std::memory_order_relaxed);
     }
 }
 
@@ -198,7 +288,8 @@ void Adapter::UpdateVibrations() {
     vibration_counter = (vibration_counter + 1) % vibration_states;
 
     for (GCController& pad : pads) {
-        const bool vibrate = pad.rumble_amplitude > vibration_counter;
+        const bool vibrate =
+            pad.rumble_amplitude.load(std::memory_order_relaxed) > vibration_counter;
         vibration_changed |= vibrate != pad.enable_vibration;
         pad.enable_vibration = vibrate;
     }
@@ -206,18 +297,16 @@ void Adapter::UpdateVibrations() {
 }
 
 void Adapter::SendVibrations() {
-    if (!rumble_enabled || !vibration_changed) {
+    if (!rumble_enabled || !vibration_changed || output_in_flight) {
         return;
     }
-    s32 size{};
     constexpr u8 rumble_command = 0x11;
     const u8 p1 = pads[0].enable_vibration;
     const u8 p2 = pads[1].enable_vibration;
     const u8 p3 = pads[2].enable_vibration;
     const u8 p4 = pads[3].enable_vibration;
-    std::array<u8, 5> payload = {rumble_command, p1, p2, p3, p4};
-    const int err = libusb_interrupt_transfer(usb_adapter_handle, output_endpoint, payload.data(),
-                                              static_cast<s32>(payload.size()), &size, 16);
+    output_payload = {rumble_command, p1, p2, p3, p4};
+    const int err = libusb_submit_transfer(output_transfer);
     if (err) {
         LOG_DEBUG(Input, "Adapter libusb write failed: {}", libusb_error_name(err));
         if (output_error_counter++ > 5) {
@@ -226,14 +315,38 @@ void Adapter::SendVibrations() {
         }
         return;
     }
-    output_error_counter = 0;
+    output_in_flight = true;
     vibration_changed = false;
 }
 
+void Adapter::OnOutputTransfer(libusb_transfer* transfer) {
+    output_in_flight = false;
+    if (transfer->status == LIBUSB_TRANSFER_CANCELLED) {
+        return;
+    }
+    if (transfer->status != LIBUSB_TRANSFER_COMPLETED) {
+        LOG_DEBUG(Input, "Adapter libusb write failed with status {}",
+                  static_cast<int>(transfer->status));
+        if (output_error_counter++ > 5) {
+            LOG_ERROR(Input, "GC adapter output timeout, Rumble disabled");
+            rumble_enabled = false;
+        }
+        // Retry with the latest state on the next update
+        vibration_changed = true;
+        return;
+    }
+    output_error_counter = 0;
+
+    // Send the changes that were coalesced while this write was in flight
+    if (adapter_input_thread_running) {
+        SendVibrations();
+    }
+}
+
 bool Adapter::RumblePlay(std::size_t port, f32 amplitude) {
     amplitude = std::clamp(amplitude, 0.0f, 1.0f);
     const auto raw_amp = static_cast<u8>(amplitude * 0x8);
-    pads[port].rumble_amplitude = raw_amp;
+    pads[port].rumble_amplitude.store(raw_amp, std::memory_order_relaxed);
 
     return rumble_enabled;
 }
@@ -376,7 +489,9 @@ void Adapter::ResetDevice(std::size_t port) {
     pads[port].rumble_amplitude = 0;
     pads[port].buttons = 0;
     pads[port].last_button = PadButton::Undefined;
-    pads[port].axis_values.fill(0);
+    for (auto& axis_value : pads[port].axis_values) {
+        axis_value.store(0, std::memory_order_relaxed);
+    }
     pads[port].axis_origin.fill(255);
 }
 
@@ -4,6 +4,8 @@
 
 #pragma once
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <functional>
 #include <mutex>
 #include <thread>
@@ -15,6 +17,7 @@
 struct libusb_context;
 struct libusb_device;
 struct libusb_device_handle;
+struct libusb_transfer;
 
 namespace GCAdapter {
 
@@ -63,12 +66,17 @@ struct GCPadStatus {
 };
 
 struct GCController {
-    ControllerTypes type{};
+    // Written by the adapter thread and read by the input devices without locking
+    std::atomic<ControllerTypes> type{};
+    std::atomic<u16> buttons{};
+    std::array<std::atomic<s16>, 6> axis_values{};
+
+    // Written by the input devices and read by the adapter thread
+    std::atomic<u8> rumble_amplitude{};
+
+    // Only accessed by the adapter thread
     bool enable_vibration{};
-    u8 rumble_amplitude{};
-    u16 buttons{};
     PadButton last_button{};
-    std::array<s16, 6> axis_values{};
     std::array<u8, 6> axis_origin{};
 };
 
@@ -101,6 +109,9 @@ public:
 private:
     using AdapterPayload = std::array<u8, 37>;
 
+    /// Number of input transfers kept queued so the adapter is polled without gaps
+    static constexpr std::size_t NUM_INPUT_TRANSFERS = 4;
+
     void UpdatePadType(std::size_t port, ControllerTypes pad_type);
     void UpdateControllers(const AdapterPayload& adapter_payload);
     void UpdateYuzuSettings(std::size_t port);
@@ -110,11 +121,22 @@ private:
 
     void AdapterInputThread();
 
+    /// Allocates the transfers and queues the input ones, returns false on failure
+    bool SubmitTransfers();
+
+    /// Cancels the queued transfers, waits for their completion and frees them
+    void CancelTransfers();
+
+    /// Completion callbacks of the asynchronous transfers, called from the input thread
+    void OnInputTransfer(libusb_transfer* transfer);
+    void OnOutputTransfer(libusb_transfer* transfer);
+
     void AdapterScanThread();
 
     bool IsPayloadCorrect(const AdapterPayload& adapter_payload, s32 payload_size);
 
-    // Updates vibration state of all controllers
+    // Updates vibration state of all controllers. Changes made while a write is in flight are
+    // coalesced and sent when it completes.
     void SendVibrations();
 
     /// For use in initialization, querying devices to find the adapter
@@ -146,6 +168,13 @@ private:
     std::array<GCController, 4> pads;
     Common::SPSCQueue<GCPadStatus> pad_queue;
 
+    std::array<libusb_transfer*, NUM_INPUT_TRANSFERS> input_transfers{};
+    std::array<AdapterPayload, NUM_INPUT_TRANSFERS> input_payloads{};
+    libusb_transfer* output_transfer = nullptr;
+    std::array<u8, 5> output_payload{};
+    std::size_t input_transfers_in_flight{};
+    bool output_in_flight{};
+
     std::thread adapter_input_thread;
     std::thread adapter_scan_thread;
     bool adapter_input_thread_running;
@@ -5,10 +5,12 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
 #include <chrono>
 #include <cmath>
 #include <functional>
 #include <mutex>
+#include <numeric>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -61,23 +63,32 @@ public:
           sdl_controller{game_controller, &SDL_GameControllerClose} {}
 
     void SetButton(int button, bool value) {
-        std::lock_guard lock{mutex};
-        state.buttons.insert_or_assign(button, value);
+        if (IsValidIndex(state.buttons, button)) {
+            state.buttons[button].store(value, std::memory_order_relaxed);
+        }
     }
 
     bool GetButton(int button) const {
-        std::lock_guard lock{mutex};
-        return state.buttons.at(button);
+        RecordRead();
+        if (!IsValidIndex(state.buttons, button)) {
+            return false;
+        }
+        return state.buttons[button].load(std::memory_order_relaxed);
     }
 
     void SetAxis(int axis, Sint16 value) {
-        std::lock_guard lock{mutex};
-        state.axes.insert_or_assign(axis, value);
+        if (IsValidIndex(state.axes, axis)) {
+            state.axes[axis].store(value, std::memory_order_relaxed);
+        }
     }
 
     float GetAxis(int axis, float range) const {
-        std::lock_guard lock{mutex};
-        return static_cast<float>(state.axes.at(axis)) / (32767.0f * range);
+        RecordRead();
+        if (!IsValidIndex(state.axes, axis)) {
+            return 0.0f;
+        }
+        return static_cast<float>(state.axes[axis].load(std::memory_order_relaxed)) /
+               (32767.0f * range);
     }
 
     bool RumblePlay(f32 amp_low, f32 amp_high, u32 time) {
@@ -129,14 +140,38 @@ public:
     }
 
     void SetHat(int hat, Uint8 direction) {
-        std::lock_guard lock{mutex};
-        state.hats.insert_or_assign(hat, direction);
+        if (IsValidIndex(state.hats, hat)) {
+            state.hats[hat].store(direction, std::memory_order_relaxed);
+        }
     }
 
     bool GetHatDirection(int hat, Uint8 direction) const {
-        std::lock_guard lock{mutex};
-        return (state.hats.at(hat) & direction) != 0;
+        RecordRead();
+        if (!IsValidIndex(state.hats, hat)) {
+            return false;
+        }
+        return (state.hats[hat].load(std::memory_order_relaxed) & direction) != 0;
     }
+
+    /**
+     * Marks the state as changed by a host event at the given time. The next read measures the
+     * latency of the change, an older unread change is kept as it is the one being waited on.
+     */
+    void MarkChanged(std::chrono::steady_clock::time_point time) {
+        s64 expected = 0;
+        const s64 time_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+        pending_change.compare_exchange_strong(expected, std::max<s64>(time_ns, 1),
+                                               std::memory_order_relaxed);
+    }
+
+    /// Adds the latencies measured on this joystick to the given histogram
+    void AccumulateLatency(std::array<u64, SDLState::NUM_LATENCY_BUCKETS>& histogram) const {
+        for (std::size_t i = 0; i < histogram.size(); ++i) {
+            histogram[i] += latency_histogram[i].load(std::memory_order_relaxed);
+        }
+    }
+
     /**
      * The guid of the joystick
      */
@@ -165,11 +200,41 @@ public:
     }
 
 private:
+    template <typename T, std::size_t N>
+    static bool IsValidIndex(const std::array<T, N>&, int index) {
+        return static_cast<std::size_t>(index) < N;
+    }
+
+    /// Completes the latency measurement of a pending change, if any
+    void RecordRead() const {
+        if (pending_change.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+        const s64 change_ns = pending_change.exchange(0, std::memory_order_relaxed);
+        if (change_ns == 0) {
+            return;
+        }
+        const s64 now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::steady_clock::now().time_since_epoch())
+                               .count();
+        const u64 latency_us = static_cast<u64>(std::max<s64>(now_ns - change_ns, 0)) / 1000;
+        const std::size_t bucket = std::min<std::size_t>(std::bit_width(latency_us),
+                                                         SDLState::NUM_LATENCY_BUCKETS - 1);
+        latency_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Written by the SDL event thread and read by the emulated HID without locking. SDL indices
+    /// are 8-bit, and tearing between two values is harmless as each is updated independently.
     struct State {
-        std::unordered_map<int, bool> buttons;
-        std::unordered_map<int, Sint16> axes;
-        std::unordered_map<int, Uint8> hats;
+        std::array<std::atomic<bool>, 256> buttons{};
+        std::array<std::atomic<Sint16>, 256> axes{};
+        std::array<std::atomic<Uint8>, 256> hats{};
     } state;
+
+    /// Host time in nanoseconds of the oldest change not yet read, zero when there is none
+    mutable std::atomic<s64> pending_change{0};
+    mutable std::array<std::atomic<u64>, SDLState::NUM_LATENCY_BUCKETS> latency_histogram{};
+
     std::string guid;
     int port;
     u16 last_state_rumble_high = 0;
@@ -177,7 +242,6 @@ private:
     std::chrono::time_point<std::chrono::system_clock> last_vibration;
     std::unique_ptr<SDL_Joystick, decltype(&SDL_JoystickClose)> sdl_joystick;
     std::unique_ptr<SDL_GameController, decltype(&SDL_GameControllerClose)> sdl_controller;
-    mutable std::mutex mutex;
 
     // Motion is initialized without PID values as motion input is not aviable for SDL2
     MotionInput motion{0.0f, 0.0f, 0.0f};
@@ -277,28 +341,36 @@ void SDLState::CloseJoystick(SDL_Joystick* sdl_joystick) {
 }
 
 void SDLState::HandleGameControllerEvent(const SDL_Event& event) {
+    // SDL timestamps are taken when the event is pumped from the host, in milliseconds
+    const auto event_age = std::chrono::milliseconds(SDL_GetTicks() - event.common.timestamp);
+    const auto change_time = std::chrono::steady_clock::now() - event_age;
+
     switch (event.type) {
     case SDL_JOYBUTTONUP: {
         if (auto joystick = GetSDLJoystickBySDLID(event.jbutton.which)) {
             joystick->SetButton(event.jbutton.button, false);
+            joystick->MarkChanged(change_time);
         }
         break;
     }
     case SDL_JOYBUTTONDOWN: {
         if (auto joystick = GetSDLJoystickBySDLID(event.jbutton.which)) {
             joystick->SetButton(event.jbutton.button, true);
+            joystick->MarkChanged(change_time);
         }
         break;
     }
     case SDL_JOYHATMOTION: {
         if (auto joystick = GetSDLJoystickBySDLID(event.jhat.which)) {
             joystick->SetHat(event.jhat.hat, event.jhat.value);
+            joystick->MarkChanged(change_time);
         }
         break;
     }
     case SDL_JOYAXISMOTION: {
         if (auto joystick = GetSDLJoystickBySDLID(event.jaxis.which)) {
             joystick->SetAxis(event.jaxis.axis, event.jaxis.value);
+            joystick->MarkChanged(change_time);
         }
         break;
     }
@@ -318,6 +390,38 @@ void SDLState::CloseJoysticks() {
     joystick_map.clear();
 }
 
+std::array<u64, SDLState::NUM_LATENCY_BUCKETS> SDLState::GetInputLatencyHistogram() {
+    std::array<u64, NUM_LATENCY_BUCKETS> histogram{};
+    std::lock_guard lock{joystick_map_mutex};
+    for (const auto& [guid, joysticks] : joystick_map) {
+        for (const auto& joystick : joysticks) {
+            joystick->AccumulateLatency(histogram);
+        }
+    }
+    return histogram;
+}
+
+void SDLState::LogInputLatency() {
+    const auto histogram = GetInputLatencyHistogram();
+    const u64 total = std::accumulate(histogram.begin(), histogram.end(), u64{0});
+    if (total == 0) {
+        return;
+    }
+    // Returns the upper bound in microseconds of the bucket containing the given percentile
+    const auto percentile = [&histogram, total](u64 percent) {
+        u64 count = 0;
+        for (std::size_t i = 0; i < histogram.size(); ++i) {
+            count += histogram[i];
+            if (count * 100 >= total * percent) {
+                return u64{1} << i;
+            }
+        }
+        return u64{1} << (histogram.size() - 1);
+    };
+    LOG_INFO(Input, "SDL input latency over {} changes: p50 < {} us, p99 < {} us", total,
+             percentile(50), percentile(99));
+}
+
 class SDLButton final : public Input::ButtonDevice {
 public:
     explicit SDLButton(std::shared_ptr<SDLJoystick> joystick_, int button_)
@@ -520,7 +624,7 @@ public:
             } else {
                 direction = 0;
             }
-            // This is necessary so accessing GetHat with hat won't crash
+            // Start from a neutral state until the first event is received
             joystick->SetHat(hat, SDL_HAT_CENTERED);
             return std::make_unique<SDLDirectionButton>(joystick, hat, direction);
         }
@@ -538,13 +642,13 @@ public:
                 trigger_if_greater = true;
                 LOG_ERROR(Input, "Unknown direction {}", direction_name);
             }
-            // This is necessary so accessing GetAxis with axis won't crash
+            // Start from a neutral state until the first event is received
             joystick->SetAxis(axis, 0);
             return std::make_unique<SDLAxisButton>(joystick, axis, threshold, trigger_if_greater);
         }
 
         const int button = params.Get("button", 0);
-        // This is necessary so accessing GetButton with button won't crash
+        // Start from a neutral state until the first event is received
         joystick->SetButton(button, false);
         return std::make_unique<SDLButton>(joystick, button);
     }
@@ -574,7 +678,7 @@ public:
         const float range = std::clamp(params.Get("range", 1.0f), 0.50f, 1.50f);
         auto joystick = state.GetSDLJoystickByGUID(guid, port);
 
-        // This is necessary so accessing GetAxis with axis_x and axis_y won't crash
+        // Start from a neutral state until the first event is received
         joystick->SetAxis(axis_x, 0);
         joystick->SetAxis(axis_y, 0);
         return std::make_unique<SDLAnalog>(joystick, axis_x, axis_y, deadzone, range);
@@ -615,7 +719,7 @@ public:
             } else {
                 direction = 0;
             }
-            // This is necessary so accessing GetHat with hat won't crash
+            // Start from a neutral state until the first event is received
             joystick->SetHat(hat, SDL_HAT_CENTERED);
             return std::make_unique<SDLDirectionMotion>(joystick, hat, direction);
         }
@@ -633,13 +737,13 @@ public:
                 trigger_if_greater = true;
                 LOG_ERROR(Input, "Unknown direction {}", direction_name);
             }
-            // This is necessary so accessing GetAxis with axis won't crash
+            // Start from a neutral state until the first event is received
             joystick->SetAxis(axis, 0);
             return std::make_unique<SDLAxisMotion>(joystick, axis, threshold, trigger_if_greater);
         }
 
         const int button = params.Get("button", 0);
-        // This is necessary so accessing GetButton with button won't crash
+        // Start from a neutral state until the first event is received
         joystick->SetButton(button, false);
         return std::make_unique<SDLButtonMotion>(joystick, button);
     }
@@ -673,10 +777,14 @@ SDLState::SDLState() {
     initialized = true;
     if (start_thread) {
         poll_thread = std::thread([this] {
-            using namespace std::chrono_literals;
+            SDL_Event event;
             while (initialized) {
-                SDL_PumpEvents();
-                std::this_thread::sleep_for(5ms);
+                // Events are handled by the event watcher as they are pumped, waiting only drains
+                // the queue. The timeout bounds how long shutting down takes.
+                if (SDL_WaitEventTimeout(&event, 10) == 1) {
+                    while (SDL_PollEvent(&event) == 1) {
+                    }
+                }
             }
         });
     }
@@ -693,6 +801,7 @@ SDLState::~SDLState() {
     UnregisterFactory<AnalogDevice>("sdl");
     UnregisterFactory<MotionDevice>("sdl");
 
+    LogInputLatency();
     CloseJoysticks();
     SDL_DelEventWatch(&SDLEventWatcher, this);
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -26,6 +27,9 @@ class SDLJoystick;
 
 class SDLState : public State {
 public:
+    /// Number of input latency histogram buckets, bucket i counts latencies below 2^i microseconds
+    static constexpr std::size_t NUM_LATENCY_BUCKETS = 20;
+
     /// Initializes and registers SDL device factories
     SDLState();
 
@@ -56,6 +60,9 @@ public:
     ButtonMapping GetButtonMappingForDevice(const Common::ParamPackage& params) override;
     AnalogMapping GetAnalogMappingForDevice(const Common::ParamPackage& params) override;
 
+    /// Returns the latencies from host joystick events until their first read by the emulated HID
+    std::array<u64, NUM_LATENCY_BUCKETS> GetInputLatencyHistogram();
+
 private:
     void InitJoystick(int joystick_index);
     void CloseJoystick(SDL_Joystick* sdl_joystick);
@@ -63,6 +70,9 @@ private:
     /// Needs to be called before SDL_QuitSubSystem.
     void CloseJoysticks();
 
+    /// Logs a summary of the measured input latency
+    void LogInputLatency();
+
     // Set to true if SDL supports game controller subsystem
     bool has_gamecontroller = false;
 
@@ -8,6 +8,7 @@
 #include <thread>
 #include <boost/asio.hpp>
 #include "common/logging/log.h"
+#include "common/thread.h"
 #include "core/settings.h"
 #include "input_common/udp/client.h"
 #include "input_common/udp/protocol.h"
@@ -26,10 +27,10 @@ class Socket {
 public:
     using clock = std::chrono::system_clock;
 
-    explicit Socket(const std::string& host, u16 port, std::size_t pad_index_, u32 client_id_,
-                    SocketCallback callback_)
-        : callback(std::move(callback_)), timer(io_service),
-          socket(io_service, udp::endpoint(udp::v4(), 0)), client_id(client_id_),
+    explicit Socket(boost::asio::io_context& io_context, const std::string& host, u16 port,
+                    std::size_t pad_index_, u32 client_id_, SocketCallback callback_)
+        : callback(std::move(callback_)), timer(io_context),
+          socket(io_context, udp::endpoint(udp::v4(), 0)), client_id(client_id_),
           pad_index(pad_index_) {
         boost::system::error_code ec{};
         auto ipv4 = boost::asio::ip::make_address_v4(host, ec);
@@ -41,27 +42,35 @@ public:
         send_endpoint = {udp::endpoint(ipv4, port)};
     }
 
-    void Stop() {
-        io_service.stop();
-    }
-
-    void Loop() {
-        io_service.run();
-    }
-
     void StartSend(const clock::time_point& from) {
         timer.expires_at(from + std::chrono::seconds(3));
-        timer.async_wait([this](const boost::system::error_code& error) { HandleSend(error); });
+        timer.async_wait([this](const boost::system::error_code& error) {
+            // Handlers that completed before Stop still run, don't rearm a stopped socket
+            if (error == boost::asio::error::operation_aborted || !socket.is_open()) {
+                return;
+            }
+            HandleSend(error);
+        });
     }
 
     void StartReceive() {
         socket.async_receive_from(
             boost::asio::buffer(receive_buffer), receive_endpoint,
             [this](const boost::system::error_code& error, std::size_t bytes_transferred) {
+                if (error == boost::asio::error::operation_aborted || !socket.is_open()) {
+                    return;
+                }
                 HandleReceive(error, bytes_transferred);
             });
     }
 
+    /// Aborts the pending operations, the socket can be destroyed once its handlers have run
+    void Stop() {
+        boost::system::error_code ignored{};
+        timer.cancel();
+        socket.close(ignored);
+    }
+
 private:
     void HandleReceive(const boost::system::error_code& error, std::size_t bytes_transferred) {
         if (auto type = Response::Validate(receive_buffer.data(), bytes_transferred)) {
@@ -111,7 +120,6 @@ private:
     }
 
     SocketCallback callback;
-    boost::asio::io_service io_service;
     boost::asio::basic_waitable_timer<clock> timer;
     udp::socket socket;
 
@@ -128,14 +136,66 @@ private:
     udp::endpoint receive_endpoint;
 };
 
-static void SocketLoop(Socket* socket) {
+static void StartSocket(Socket* socket) {
     socket->StartReceive();
     socket->StartSend(Socket::clock::now());
-    socket->Loop();
+}
+
+/// Runs a single socket on its own I/O context until the context is stopped
+static void SocketLoop(boost::asio::io_context* io_context, Socket* socket) {
+    StartSocket(socket);
+    io_context->run();
+}
+
+void DeviceStatus::PushSample(const PadSample& sample) {
+    const u64 index = write_index.load(std::memory_order_relaxed) + 1;
+    Slot& slot = slots[index % NUM_SAMPLES];
+    const u64 sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.sample = sample;
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+    write_index.store(index, std::memory_order_release);
+}
+
+bool DeviceStatus::ReadSample(u64 index, PadSample& sample) const {
+    const Slot& slot = slots[index % NUM_SAMPLES];
+    while (true) {
+        const u64 sequence = slot.sequence.load(std::memory_order_acquire);
+        sample = slot.sample;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ((sequence & 1) == 0 && slot.sequence.load(std::memory_order_relaxed) == sequence) {
+            break;
+        }
+    }
+    // The slot may have been reused for a newer sample while we were reading
+    return write_index.load(std::memory_order_acquire) - index < NUM_SAMPLES;
+}
+
+Input::MotionStatus DeviceStatus::GetMotionStatus() const {
+    const u64 index = write_index.load(std::memory_order_acquire);
+    if (index == 0) {
+        return {};
+    }
+    // Always present the newest sample, blending with older ones would only add latency
+    PadSample sample;
+    ReadSample(index, sample);
+    return {sample.accel, sample.gyro, sample.rotation, sample.orientation};
+}
+
+std::tuple<float, float, bool> DeviceStatus::GetTouchStatus() const {
+    const u64 index = write_index.load(std::memory_order_acquire);
+    if (index == 0) {
+        return {};
+    }
+    PadSample sample;
+    ReadSample(index, sample);
+    return {sample.touch_x, sample.touch_y, sample.touch_active};
 }
 
 Client::Client() {
     LOG_INFO(Input, "Udp Initialization started");
+    io_context = std::make_unique<boost::asio::io_context>();
     for (std::size_t client = 0; client < clients.size(); client++) {
         const auto pad = client % 4;
         StartCommunication(client, Settings::values.udp_input_address,
@@ -145,6 +205,7 @@ Client::Client() {
         // Real HW values are unknown, 0.0001 is an approximate to Standard
         clients[client].motion.SetGyroThreshold(0.0001f);
     }
+    StartReactor();
 }
 
 Client::~Client() {
@@ -170,9 +231,9 @@ std::vector<Common::ParamPackage> Client::GetInputDevices() const {
 bool Client::DeviceConnected(std::size_t pad) const {
     // Use last timestamp to detect if the socket has stopped sending data
     const auto now = std::chrono::system_clock::now();
+    const auto last_motion_update = clients[pad].last_motion_update.load();
     const auto time_difference = static_cast<u64>(
-        std::chrono::duration_cast<std::chrono::milliseconds>(now - clients[pad].last_motion_update)
-            .count());
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - last_motion_update).count());
     return time_difference < 1000 && clients[pad].active == 1;
 }
 
@@ -184,9 +245,10 @@ void Client::ReloadUDPClient() {
 void Client::ReloadSocket(const std::string& host, u16 port, std::size_t pad_index, u32 client_id) {
     // client number must be determined from host / port and pad index
     const std::size_t client = pad_index;
-    clients[client].socket->Stop();
-    clients[client].thread.join();
+    StopReactor();
+    DestroySocket(client);
     StartCommunication(client, host, port, pad_index, client_id);
+    StartReactor();
 }
 
 void Client::OnVersion(Response::Version data) {
@@ -200,6 +262,9 @@ void Client::OnPortInfo(Response::PortInfo data) {
 void Client::OnPadData(Response::PadData data) {
     // Client number must be determined from host / port and pad index
     const std::size_t client = data.info.id;
+    if (client >= clients.size()) {
+        return;
+    }
     LOG_TRACE(Input, "PadData packet received");
     if (data.packet_counter == clients[client].packet_sequence) {
         LOG_WARNING(
@@ -211,11 +276,22 @@ void Client::OnPadData(Response::PadData data) {
     clients[client].active = data.info.is_pad_active;
     clients[client].packet_sequence = data.packet_counter;
     const auto now = std::chrono::system_clock::now();
-    const auto time_difference =
+    const u64 host_difference =
         static_cast<u64>(std::chrono::duration_cast<std::chrono::microseconds>(
-                             now - clients[client].last_motion_update)
+                             now - clients[client].last_motion_update.load())
                              .count());
     clients[client].last_motion_update = now;
+
+    // Integrate with the server's sample timestamps, host arrival times jitter with the network
+    const u64 motion_timestamp = data.motion_timestamp;
+    const u64 last_motion_timestamp = clients[client].last_motion_timestamp;
+    clients[client].last_motion_timestamp = motion_timestamp;
+    u64 time_difference = host_difference;
+    if (last_motion_timestamp != 0 && motion_timestamp > last_motion_timestamp &&
+        motion_timestamp - last_motion_timestamp < 1000000) {
+        time_difference = motion_timestamp - last_motion_timestamp;
+    }
+
     const Common::Vec3f raw_gyroscope = {data.gyro.pitch, data.gyro.roll, -data.gyro.yaw};
     clients[client].motion.SetAcceleration({data.accel.x, -data.accel.z, data.accel.y});
     // Gyroscope values are not it the correct scale from better joy.
@@ -225,38 +301,41 @@ void Client::OnPadData(Response::PadData data) {
     clients[client].motion.UpdateRotation(time_difference);
     clients[client].motion.UpdateOrientation(time_difference);
 
-    {
-        std::lock_guard guard(clients[client].status.update_mutex);
-        clients[client].status.motion_status = clients[client].motion.GetMotion();
-
-        // TODO: add a setting for "click" touch. Click touch refers to a device that differentiates
-        // between a simple "tap" and a hard press that causes the touch screen to click.
-        const bool is_active = data.touch_1.is_active != 0;
-
-        float x = 0;
-        float y = 0;
-
-        if (is_active && clients[client].status.touch_calibration) {
-            const u16 min_x = clients[client].status.touch_calibration->min_x;
-            const u16 max_x = clients[client].status.touch_calibration->max_x;
-            const u16 min_y = clients[client].status.touch_calibration->min_y;
-            const u16 max_y = clients[client].status.touch_calibration->max_y;
-
-            x = static_cast<float>(std::clamp(static_cast<u16>(data.touch_1.x), min_x, max_x) -
-                                   min_x) /
-                static_cast<float>(max_x - min_x);
-            y = static_cast<float>(std::clamp(static_cast<u16>(data.touch_1.y), min_y, max_y) -
-                                   min_y) /
-                static_cast<float>(max_y - min_y);
-        }
+    PadSample sample{
+        .timestamp = static_cast<u64>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                          std::chrono::steady_clock::now().time_since_epoch())
+                                          .count()),
+        .accel = clients[client].motion.GetAcceleration(),
+        .gyro = clients[client].motion.GetGyroscope(),
+        .rotation = clients[client].motion.GetRotations(),
+        .orientation = clients[client].motion.GetOrientation(),
+    };
+
+    // TODO: add a setting for "click" touch. Click touch refers to a device that differentiates
+    // between a simple "tap" and a hard press that causes the touch screen to click.
+    sample.touch_active = data.touch_1.is_active != 0;
+
+    const auto& touch_calibration = clients[client].status.touch_calibration;
+    if (sample.touch_active && touch_calibration) {
+        const u16 min_x = touch_calibration->min_x;
+        const u16 max_x = touch_calibration->max_x;
+        const u16 min_y = touch_calibration->min_y;
+        const u16 max_y = touch_calibration->max_y;
+
+        sample.touch_x =
+            static_cast<float>(std::clamp(static_cast<u16>(data.touch_1.x), min_x, max_x) -
+                               min_x) /
+            static_cast<float>(max_x - min_x);
+        sample.touch_y =
+            static_cast<float>(std::clamp(static_cast<u16>(data.touch_1.y), min_y, max_y) -
+                               min_y) /
+            static_cast<float>(max_y - min_y);
+    }
 
-        clients[client].status.touch_status = {x, y, is_active};
+    clients[client].status.PushSample(sample);
 
-        if (configuring) {
-            const Common::Vec3f gyroscope = clients[client].motion.GetGyroscope();
-            const Common::Vec3f accelerometer = clients[client].motion.GetAcceleration();
-            UpdateYuzuSettings(client, accelerometer, gyroscope, is_active);
-        }
+    if (configuring) {
+        UpdateYuzuSettings(client, sample.accel, sample.gyro, sample.touch_active);
     }
 }
 
@@ -266,15 +345,44 @@ void Client::StartCommunication(std::size_t client, const std::string& host, u16
                             [this](Response::PortInfo info) { OnPortInfo(info); },
                             [this](Response::PadData data) { OnPadData(data); }};
     LOG_INFO(Input, "Starting communication with UDP input server on {}:{}", host, port);
-    clients[client].socket = std::make_unique<Socket>(host, port, pad_index, client_id, callback);
-    clients[client].thread = std::thread{SocketLoop, clients[client].socket.get()};
+    clients[client].socket =
+        std::make_unique<Socket>(*io_context, host, port, pad_index, client_id, callback);
+    StartSocket(clients[client].socket.get());
+}
+
+void Client::StartReactor() {
+    io_context->restart();
+    reactor_thread = std::thread([this] {
+        Common::SetCurrentThreadName("yuzu:input:CemuhookUDP");
+        io_context->run();
+    });
+}
+
+void Client::StopReactor() {
+    io_context->stop();
+    if (reactor_thread.joinable()) {
+        reactor_thread.join();
+    }
 }
 
 void Client::Reset() {
-    for (auto& client : clients) {
-        client.socket->Stop();
-        client.thread.join();
+    StopReactor();
+    for (std::size_t client = 0; client < clients.size(); ++client) {
+        DestroySocket(client);
+    }
+}
+
+void Client::DestroySocket(std::size_t client) {
+    auto& socket = clients[client].socket;
+    if (!socket) {
+        return;
     }
+    // Stopping the reactor can leave handlers of successfully completed operations queued.
+    // Close the socket and run them before it's freed, they return once they see it closed.
+    socket->Stop();
+    io_context->restart();
+    io_context->poll();
+    socket.reset();
 }
 
 void Client::UpdateYuzuSettings(std::size_t client, const Common::Vec3<float>& acc,
@@ -342,10 +450,11 @@ void TestCommunication(const std::string& host, u16 port, std::size_t pad_index,
             .port_info = [](Response::PortInfo) {},
             .pad_data = [&](Response::PadData) { success_event.Set(); },
         };
-        Socket socket{host, port, pad_index, client_id, std::move(callback)};
-        std::thread worker_thread{SocketLoop, &socket};
+        boost::asio::io_context io_context;
+        Socket socket{io_context, host, port, pad_index, client_id, std::move(callback)};
+        std::thread worker_thread{SocketLoop, &io_context, &socket};
         const bool result = success_event.WaitFor(std::chrono::seconds(8));
-        socket.Stop();
+        io_context.stop();
         worker_thread.join();
         if (result) {
             success_callback();
@@ -401,10 +510,11 @@ CalibrationConfigurationJob::CalibrationConfigurationJob(
                                         complete_event.Set();
                                     }
                                 }};
-        Socket socket{host, port, pad_index, client_id, std::move(callback)};
-        std::thread worker_thread{SocketLoop, &socket};
+        boost::asio::io_context io_context;
+        Socket socket{io_context, host, port, pad_index, client_id, std::move(callback)};
+        std::thread worker_thread{SocketLoop, &io_context, &socket};
         complete_event.Wait();
-        socket.Stop();
+        io_context.stop();
         worker_thread.join();
     }).detach();
 }
@@ -4,13 +4,15 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <string>
 #include <thread>
 #include <tuple>
+#include <type_traits>
 #include "common/common_types.h"
 #include "common/param_package.h"
 #include "common/thread.h"
@@ -19,6 +21,10 @@
 #include "core/frontend/input.h"
 #include "input_common/motion_input.h"
 
+namespace boost::asio {
+class io_context;
+}
+
 namespace InputCommon::CemuhookUDP {
 
 constexpr u16 DEFAULT_PORT = 26760;
@@ -53,10 +59,28 @@ struct UDPPadStatus {
     f32 motion_value{0.0f};
 };
 
+/// Motion and touch state of a pad when one of its packets was received
+struct PadSample {
+    u64 timestamp{}; ///< Host time the packet was received, in microseconds
+    Common::Vec3f accel;
+    Common::Vec3f gyro;
+    Common::Vec3f rotation;
+    std::array<Common::Vec3f, 3> orientation;
+    f32 touch_x{};
+    f32 touch_y{};
+    bool touch_active{};
+};
+static_assert(std::is_trivially_copyable_v<PadSample>, "PadSample must be trivially copyable.");
+
 struct DeviceStatus {
-    std::mutex update_mutex;
-    Input::MotionStatus motion_status;
-    std::tuple<float, float, bool> touch_status;
+    /// Publishes a new sample, must only be called from the socket thread
+    void PushSample(const PadSample& sample);
+
+    /// Returns the motion of the latest sample without locking
+    Input::MotionStatus GetMotionStatus() const;
+
+    /// Returns the touch state of the latest sample without locking
+    std::tuple<float, float, bool> GetTouchStatus() const;
 
     // calibration data for scaling the device's touch area to 3ds
     struct CalibrationData {
@@ -66,6 +90,21 @@ struct DeviceStatus {
         u16 max_y{};
     };
     std::optional<CalibrationData> touch_calibration;
+
+private:
+    static constexpr std::size_t NUM_SAMPLES = 8;
+
+    /// Ring slot guarded by a sequence counter, odd while the sample is being written
+    struct Slot {
+        std::atomic<u64> sequence{0};
+        PadSample sample;
+    };
+
+    /// Reads the sample pushed at the given index, returns false if it has been overwritten
+    bool ReadSample(u64 index, PadSample& sample) const;
+
+    std::array<Slot, NUM_SAMPLES> slots;
+    std::atomic<u64> write_index{0};
 };
 
 class Client {
@@ -97,19 +136,26 @@ private:
     struct ClientData {
         std::unique_ptr<Socket> socket;
         DeviceStatus status;
-        std::thread thread;
         u64 packet_sequence = 0;
-        u8 active = 0;
+        std::atomic<u8> active = 0;
 
         // Realtime values
         // motion is initalized with PID values for drift correction on joycons
         InputCommon::MotionInput motion{0.3f, 0.005f, 0.0f};
-        std::chrono::time_point<std::chrono::system_clock> last_motion_update;
+        std::atomic<std::chrono::system_clock::time_point> last_motion_update;
+        u64 last_motion_timestamp = 0;
     };
 
     // For shutting down, clear all data, join all threads, release usb
     void Reset();
 
+    /// Runs the sockets of every client on the shared reactor thread
+    void StartReactor();
+    void StopReactor();
+
+    /// Releases the socket of a client, must be called with the reactor stopped
+    void DestroySocket(std::size_t client);
+
     void OnVersion(Response::Version);
     void OnPortInfo(Response::PortInfo);
     void OnPadData(Response::PadData);
@@ -120,6 +166,10 @@ private:
 
     bool configuring = false;
 
+    /// All the client sockets are driven by a single I/O context and thread
+    std::unique_ptr<boost::asio::io_context> io_context;
+    std::thread reactor_thread;
+
     std::array<ClientData, 4> clients;
     std::array<Common::SPSCQueue<UDPPadStatus>, 4> pad_queue;
 };
@@ -17,7 +17,7 @@ public:
         : ip(std::move(ip_)), port(port_), pad(pad_), client(client_) {}
 
     Input::MotionStatus GetStatus() const override {
-        return client->GetPadState(pad).motion_status;
+        return client->GetPadState(pad).GetMotionStatus();
     }
 
 private:
@@ -81,7 +81,7 @@ public:
         : ip(std::move(ip_)), port(port_), pad(pad_), client(client_) {}
 
     std::tuple<float, float, bool> GetStatus() const override {
-        return client->GetPadState(pad).touch_status;
+        return client->GetPadState(pad).GetTouchStatus();
     }
 
 private:
@@ -0,0 +1,150 @@
+// Copyright 2020 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/core.h"
+#include "core/hle/kernel/thread.h"
+#include "core/hle/kernel/thread_wait_queue.h"
+
+namespace {
+
+constexpr VAddr ADDRESS = 0x8000'1000;
+
+std::shared_ptr<Kernel::Thread> MakeThread(u32 priority) {
+    return Kernel::Thread::Create(Core::System::GetInstance(), Kernel::THREADTYPE_HLE,
+                                  "ThreadWaitQueueTest", 0, priority, 0, 0, 0, nullptr,
+                                  [](void*) {}, nullptr)
+        .Unwrap();
+}
+
+/// Pops up to num_to_wake threads waiting on an address the same way AddressArbiter does
+std::vector<Kernel::Thread*> Wake(Kernel::ThreadWaitQueue& queue, VAddr address,
+                                  std::size_t num_to_wake) {
+    std::vector<Kernel::Thread*> woken;
+    while (woken.size() < num_to_wake) {
+        Kernel::Thread* const thread = queue.Front(address);
+        if (thread == nullptr) {
+            break;
+        }
+        queue.Remove(thread);
+        woken.push_back(thread);
+    }
+    return woken;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("ThreadWaitQueue::WakeOrder", "[core][kernel]") {
+    const auto low_a = MakeThread(40);
+    const auto high = MakeThread(10);
+    const auto mid_a = MakeThread(20);
+    const auto low_b = MakeThread(40);
+    const auto mid_b = MakeThread(20);
+
+    Kernel::ThreadWaitQueue queue;
+    for (const auto& thread : {low_a, high, mid_a, low_b, mid_b}) {
+        queue.Insert(thread.get(), ADDRESS);
+    }
+    REQUIRE(queue.Count(ADDRESS, 16) == 5);
+    REQUIRE(queue.Count(ADDRESS, 3) == 3);
+
+    // Highest priority first, FIFO among equal priorities
+    REQUIRE(Wake(queue, ADDRESS, 2) == std::vector{high.get(), mid_a.get()});
+    REQUIRE(queue.Count(ADDRESS, 16) == 3);
+    REQUIRE(Wake(queue, ADDRESS, 16) == std::vector{mid_b.get(), low_a.get(), low_b.get()});
+    REQUIRE(queue.Front(ADDRESS) == nullptr);
+    REQUIRE(queue.Empty());
+}
+
+TEST_CASE("ThreadWaitQueue::SeparateAddresses", "[core][kernel]") {
+    // More addresses than buckets, so some of them are guaranteed to share a bucket
+    constexpr std::size_t num_addresses = 300;
+
+    std::vector<std::shared_ptr<Kernel::Thread>> threads;
+    Kernel::ThreadWaitQueue queue;
+    for (std::size_t i = 0; i < num_addresses; ++i) {
+        threads.push_back(MakeThread(static_cast<u32>(i % 64)));
+        queue.Insert(threads.back().get(), ADDRESS + i * 4);
+    }
+
+    for (std::size_t i = 0; i < num_addresses; ++i) {
+        const VAddr address = ADDRESS + i * 4;
+        REQUIRE(queue.Count(address, 16) == 1);
+        REQUIRE(queue.Front(address) == threads[i].get());
+        REQUIRE(queue.Next(threads[i].get()) == nullptr);
+    }
+
+    for (std::size_t i = 0; i < num_addresses; ++i) {
+        REQUIRE(Wake(queue, ADDRESS + i * 4, 16) == std::vector{threads[i].get()});
+    }
+    REQUIRE(queue.Empty());
+}
+
+TEST_CASE("ThreadWaitQueue::Timeout", "[core][kernel]") {
+    const auto first = MakeThread(20);
+    const auto timed_out = MakeThread(20);
+    const auto last = MakeThread(30);
+
+    Kernel::ThreadWaitQueue queue;
+    queue.Insert(first.get(), ADDRESS);
+    queue.Insert(timed_out.get(), ADDRESS);
+    queue.Insert(last.get(), ADDRESS);
+
+    // A waiter whose timeout expired unlinks itself without disturbing the others
+    queue.Remove(timed_out.get());
+    REQUIRE(queue.Count(ADDRESS, 16) == 2);
+    REQUIRE(queue.Next(first.get()) == last.get());
+
+    // Signaling after the timeout does not wake the timed out thread twice
+    queue.Remove(timed_out.get());
+    REQUIRE(Wake(queue, ADDRESS, 16) == std::vector{first.get(), last.get()});
+    REQUIRE(queue.Empty());
+
+    // The timed out thread can wait again
+    queue.Insert(timed_out.get(), ADDRESS);
+    REQUIRE(queue.Front(ADDRESS) == timed_out.get());
+    queue.Remove(timed_out.get());
+}
+
+TEST_CASE("ThreadWaitQueue::Cancellation", "[core][kernel]") {
+    const auto head = MakeThread(10);
+    const auto tail = MakeThread(50);
+    const auto other = MakeThread(10);
+
+    Kernel::ThreadWaitQueue queue;
+    Kernel::ThreadWaitQueue other_queue;
+    queue.Insert(head.get(), ADDRESS);
+    queue.Insert(tail.get(), ADDRESS);
+    other_queue.Insert(other.get(), ADDRESS);
+
+    // Removing a thread linked to another queue does nothing
+    queue.Remove(other.get());
+    REQUIRE(other_queue.Front(ADDRESS) == other.get());
+    REQUIRE(queue.Count(ADDRESS, 16) == 2);
+
+    // Cancelling the head and the tail leaves the queue empty
+    queue.Remove(head.get());
+    REQUIRE(queue.Front(ADDRESS) == tail.get());
+    queue.Remove(tail.get());
+    REQUIRE(queue.Front(ADDRESS) == nullptr);
+    REQUIRE(queue.Empty());
+
+    // Threads still waiting when a queue is destroyed are unlinked and can wait elsewhere
+    {
+        Kernel::ThreadWaitQueue dying_queue;
+        dying_queue.Insert(head.get(), ADDRESS);
+        dying_queue.Insert(tail.get(), ADDRESS);
+    }
+    queue.Insert(head.get(), ADDRESS);
+    queue.Insert(tail.get(), ADDRESS);
+    REQUIRE(Wake(queue, ADDRESS, 16) == std::vector{head.get(), tail.get()});
+
+    other_queue.Remove(other.get());
+    REQUIRE(other_queue.Empty());
+}
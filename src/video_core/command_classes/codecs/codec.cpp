@@ -62,6 +62,10 @@ void Codec::Decode() {
         av_frame = av_frame_alloc();
         av_opt_set(av_codec_ctx->priv_data, "tune", "zerolatency", 0);
 
+        // Decode slices in parallel, frame threading would delay frames past the VIC execute
+        av_codec_ctx->thread_type = FF_THREAD_SLICE;
+        av_codec_ctx->thread_count = 0;
+
         // TODO(ameerj): libavcodec gpu hw acceleration
 
         const auto av_error = avcodec_open2(av_codec_ctx, av_codec, nullptr);
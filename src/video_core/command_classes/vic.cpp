@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <array>
+#include <cstring>
 #include "common/assert.h"
 #include "video_core/command_classes/nvdec.h"
 #include "video_core/command_classes/vic.h"
@@ -19,7 +20,18 @@ namespace Tegra {
 
 Vic::Vic(GPU& gpu_, std::shared_ptr<Nvdec> nvdec_processor_)
     : gpu(gpu_), nvdec_processor(std::move(nvdec_processor_)) {}
-Vic::~Vic() = default;
+Vic::~Vic() {
+    sws_freeContext(scaler_ctx);
+}
+
+u8* Vic::GetConvertedFrameBuffer(std::size_t size) {
+    if (size > converted_frame_buffer_size) {
+        // av_malloc keeps the buffer aligned for the SIMD paths of swscale
+        converted_frame_buffer = {static_cast<u8*>(av_malloc(size)), av_free};
+        converted_frame_buffer_size = size;
+    }
+    return converted_frame_buffer.get();
+}
 
 void Vic::VicStateWrite(u32 offset, u32 arguments) {
     u8* const state_offset = reinterpret_cast<u8*>(&vic_state) + offset * sizeof(u32);
@@ -70,7 +82,7 @@ void Vic::Execute() {
             return;
         }
         if (scaler_ctx == nullptr || frame->width != scaler_width ||
-            frame->height != scaler_height) {
+            frame->height != scaler_height || pixel_format != scaler_format) {
             const AVPixelFormat target_format =
                 (pixel_format == VideoPixelFormat::RGBA8) ? AV_PIX_FMT_RGBA : AV_PIX_FMT_BGRA;
 
@@ -84,15 +96,13 @@ void Vic::Execute() {
 
             scaler_width = frame->width;
             scaler_height = frame->height;
+            scaler_format = pixel_format;
         }
         // Get Converted frame
         const std::size_t linear_size = frame->width * frame->height * 4;
 
-        using AVMallocPtr = std::unique_ptr<u8, decltype(&av_free)>;
-        AVMallocPtr converted_frame_buffer{static_cast<u8*>(av_malloc(linear_size)), av_free};
-
         const int converted_stride{frame->width * 4};
-        u8* const converted_frame_buf_addr{converted_frame_buffer.get()};
+        u8* const converted_frame_buf_addr{GetConvertedFrameBuffer(linear_size)};
 
         sws_scale(scaler_ctx, frame->data, frame->linesize, 0, frame->height,
                   &converted_frame_buf_addr, &converted_stride);
@@ -103,9 +113,16 @@ void Vic::Execute() {
             const u32 block_height = static_cast<u32>(config.block_linear_height_log2);
             const auto size = Tegra::Texture::CalculateSize(true, 4, frame->width, frame->height, 1,
                                                             block_height, 0);
-            std::vector<u8> swizzled_data(size);
+            if (frame->width != swizzle_width || frame->height != swizzle_height ||
+                block_height != swizzle_block_height) {
+                // Gob padding is not written by the swizzle, clear what the last size left there
+                swizzled_data.assign(size, 0);
+                swizzle_width = frame->width;
+                swizzle_height = frame->height;
+                swizzle_block_height = block_height;
+            }
             Tegra::Texture::CopySwizzledData(frame->width, frame->height, 1, 4, 4,
-                                             swizzled_data.data(), converted_frame_buffer.get(),
+                                             swizzled_data.data(), converted_frame_buf_addr,
                                              false, block_height, 0, 1);
 
             gpu.MemoryManager().WriteBlock(output_surface_luma_address, swizzled_data.data(), size);
@@ -139,22 +156,22 @@ void Vic::Execute() {
         const auto stride = frame->linesize[0];
         const auto half_stride = frame->linesize[1];
 
-        std::vector<u8> luma_buffer(aligned_width * surface_height);
-        std::vector<u8> chroma_buffer(aligned_width * half_height);
+        const std::size_t luma_size = aligned_width * surface_height;
+        const std::size_t chroma_size = aligned_width * half_height;
+        if (surface_width != yuv_width || surface_height != yuv_height) {
+            // Row padding and the last luma row are not written, clear what the last size left
+            luma_buffer.assign(luma_size, 0);
+            chroma_buffer.assign(chroma_size, 0);
+            yuv_width = surface_width;
+            yuv_height = surface_height;
+        }
 
         // Populate luma buffer
         for (std::size_t y = 0; y < surface_height - 1; ++y) {
-            std::size_t src = y * stride;
-            std::size_t dst = y * aligned_width;
-
-            std::size_t size = surface_width;
-
-            for (std::size_t offset = 0; offset < size; ++offset) {
-                luma_buffer[dst + offset] = luma_ptr[src + offset];
-            }
+            std::memcpy(luma_buffer.data() + y * aligned_width, luma_ptr + y * stride,
+                        surface_width);
         }
-        gpu.MemoryManager().WriteBlock(output_surface_luma_address, luma_buffer.data(),
-                                       luma_buffer.size());
+        gpu.MemoryManager().WriteBlock(output_surface_luma_address, luma_buffer.data(), luma_size);
 
         // Populate chroma buffer from both channels with interleaving.
         for (std::size_t y = 0; y < half_height; ++y) {
@@ -167,7 +184,7 @@ void Vic::Execute() {
             }
         }
         gpu.MemoryManager().WriteBlock(output_surface_chroma_u_address, chroma_buffer.data(),
-                                       chroma_buffer.size());
+                                       chroma_size);
         gpu.Maxwell3D().OnMemoryWrite();
         break;
     }
@@ -102,9 +102,25 @@ private:
     GPUVAddr output_surface_chroma_u_address{};
     GPUVAddr output_surface_chroma_v_address{};
 
+    /// Returns a buffer of at least the given size, reusing the previous allocation
+    u8* GetConvertedFrameBuffer(std::size_t size);
+
     SwsContext* scaler_ctx{};
     s32 scaler_width{};
     s32 scaler_height{};
+    VideoPixelFormat scaler_format{};
+
+    // Scratch buffers kept across frames to avoid per-frame allocations
+    std::unique_ptr<u8, void (*)(void*)> converted_frame_buffer{nullptr, nullptr};
+    std::size_t converted_frame_buffer_size{};
+    std::vector<u8> swizzled_data;
+    s32 swizzle_width{};
+    s32 swizzle_height{};
+    u32 swizzle_block_height{};
+    std::vector<u8> luma_buffer;
+    std::vector<u8> chroma_buffer;
+    std::size_t yuv_width{};
+    std::size_t yuv_height{};
 };
 
 } // namespace Tegra
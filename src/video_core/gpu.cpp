@@ -3,8 +3,12 @@
 // Refer to the license.txt file included.
 
 #include <chrono>
+#include <ctime>
+
+#include <fmt/chrono.h>
 
 #include "common/assert.h"
+#include "common/file_util.h"
 #include "common/microprofile.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -18,6 +22,7 @@
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/engines/maxwell_dma.h"
 #include "video_core/gpu.h"
+#include "video_core/gpu_trace.h"
 #include "video_core/memory_manager.h"
 #include "video_core/renderer_base.h"
 #include "video_core/shader_notify.h"
@@ -36,7 +41,16 @@ GPU::GPU(Core::System& system_, bool is_async_, bool use_nvdec_)
       kepler_compute{std::make_unique<Engines::KeplerCompute>(system, *memory_manager)},
       maxwell_dma{std::make_unique<Engines::MaxwellDMA>(system, *memory_manager)},
       kepler_memory{std::make_unique<Engines::KeplerMemory>(system, *memory_manager)},
-      shader_notify{std::make_unique<VideoCore::ShaderNotify>()}, is_async{is_async_} {}
+      shader_notify{std::make_unique<VideoCore::ShaderNotify>()}, is_async{is_async_} {
+    if (Settings::values.capture_gpu_trace) {
+        const std::time_t t = std::time(nullptr);
+        const std::string filename =
+            fmt::format("{}/gpu_trace_{:%F-%H-%M-%S}.ygt",
+                        Common::FS::GetUserPath(Common::FS::UserPath::LogDir), *std::localtime(&t));
+        trace_recorder = std::make_unique<GPUTraceRecorder>(system.Memory(), filename);
+        memory_manager->BindTraceRecorder(trace_recorder.get());
+    }
+}
 
 GPU::~GPU() = default;
 
@@ -48,6 +62,9 @@ void GPU::BindRenderer(std::unique_ptr<VideoCore::RendererBase> renderer_) {
     maxwell_3d->BindRasterizer(rasterizer);
     fermi_2d->BindRasterizer(rasterizer);
     kepler_compute->BindRasterizer(rasterizer);
+    if (trace_recorder) {
+        trace_recorder->BindRasterizer(rasterizer);
+    }
 }
 
 Engines::Maxwell3D& GPU::Maxwell3D() {
@@ -139,6 +139,7 @@ enum class EngineID {
     MAXWELL_DMA_COPY_A = 0xB0B5,
 };
 
+class GPUTraceRecorder;
 class MemoryManager;
 
 class GPU {
@@ -365,6 +366,7 @@ protected:
     std::unique_ptr<Tegra::DmaPusher> dma_pusher;
     std::unique_ptr<Tegra::CDmaPusher> cdma_pusher;
     std::unique_ptr<VideoCore::RendererBase> renderer;
+    std::unique_ptr<Tegra::GPUTraceRecorder> trace_recorder;
     const bool use_nvdec;
 
 private:
@@ -6,6 +6,7 @@
 #include "core/hardware_interrupt_manager.h"
 #include "video_core/gpu_asynch.h"
 #include "video_core/gpu_thread.h"
+#include "video_core/gpu_trace.h"
 #include "video_core/renderer_base.h"
 
 namespace VideoCommon {
@@ -30,6 +31,9 @@ void GPUAsynch::ReleaseContext() {
 }
 
 void GPUAsynch::PushGPUEntries(Tegra::CommandList&& entries) {
+    if (trace_recorder) {
+        trace_recorder->RecordCommandList(entries);
+    }
     gpu_thread.SubmitList(std::move(entries));
 }
 
@@ -63,10 +67,16 @@ void GPUAsynch::FlushRegion(VAddr addr, u64 size) {
 }
 
 void GPUAsynch::InvalidateRegion(VAddr addr, u64 size) {
+    if (trace_recorder) {
+        trace_recorder->MarkDirty(addr, size);
+    }
     gpu_thread.InvalidateRegion(addr, size);
 }
 
 void GPUAsynch::FlushAndInvalidateRegion(VAddr addr, u64 size) {
+    if (trace_recorder) {
+        trace_recorder->MarkDirty(addr, size);
+    }
     gpu_thread.FlushAndInvalidateRegion(addr, size);
 }
 
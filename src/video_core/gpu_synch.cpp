@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include "video_core/gpu_synch.h"
+#include "video_core/gpu_trace.h"
 #include "video_core/renderer_base.h"
 
 namespace VideoCommon {
@@ -22,6 +23,9 @@ void GPUSynch::ReleaseContext() {
 }
 
 void GPUSynch::PushGPUEntries(Tegra::CommandList&& entries) {
+    if (trace_recorder) {
+        trace_recorder->RecordCommandList(entries);
+    }
     dma_pusher->Push(std::move(entries));
     dma_pusher->DispatchCalls();
 }
@@ -51,10 +55,16 @@ void GPUSynch::FlushRegion(VAddr addr, u64 size) {
 }
 
 void GPUSynch::InvalidateRegion(VAddr addr, u64 size) {
+    if (trace_recorder) {
+        trace_recorder->MarkDirty(addr, size);
+    }
     renderer->Rasterizer().InvalidateRegion(addr, size);
 }
 
 void GPUSynch::FlushAndInvalidateRegion(VAddr addr, u64 size) {
+    if (trace_recorder) {
+        trace_recorder->MarkDirty(addr, size);
+    }
     renderer->Rasterizer().FlushAndInvalidateRegion(addr, size);
 }
 
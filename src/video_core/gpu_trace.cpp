@@ -0,0 +1,291 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/alignment.h"
+#include "common/logging/log.h"
+#include "common/zstd_compression.h"
+#include "core/memory.h"
+#include "video_core/gpu.h"
+#include "video_core/gpu_trace.h"
+#include "video_core/memory_manager.h"
+#include "video_core/rasterizer_interface.h"
+
+namespace Tegra {
+
+namespace {
+
+constexpr s32 PAGE_COMPRESSION_LEVEL = 3;
+
+template <typename T>
+std::vector<u8> MakePayload(const T& value) {
+    std::vector<u8> payload(sizeof(T));
+    std::memcpy(payload.data(), &value, sizeof(T));
+    return payload;
+}
+
+template <typename T>
+T ReadPayload(const std::vector<u8>& payload, std::size_t offset) {
+    T value;
+    std::memcpy(&value, payload.data() + offset, sizeof(T));
+    return value;
+}
+
+} // Anonymous namespace
+
+GPUTraceRecorder::GPUTraceRecorder(Core::Memory::Memory& cpu_memory_, const std::string& filename)
+    : cpu_memory{cpu_memory_}, file{filename, "wb"} {
+    if (!file.IsOpen()) {
+        LOG_ERROR(HW_GPU, "Failed to create GPU trace file {}", filename);
+        return;
+    }
+    const Trace::FileHeader header{
+        .magic = Trace::MAGIC,
+        .version = Trace::VERSION,
+    };
+    file.WriteObject(header);
+    is_open = true;
+    LOG_INFO(HW_GPU, "Capturing GPU trace to {}", filename);
+}
+
+GPUTraceRecorder::~GPUTraceRecorder() = default;
+
+void GPUTraceRecorder::BindRasterizer(VideoCore::RasterizerInterface& rasterizer_) {
+    std::scoped_lock lock{mutex};
+    rasterizer = &rasterizer_;
+}
+
+void GPUTraceRecorder::RecordMap(GPUVAddr gpu_addr, VAddr cpu_addr, u64 size) {
+    std::scoped_lock lock{mutex};
+    if (!is_open) {
+        return;
+    }
+    EraseMappings(gpu_addr, size);
+    mappings.emplace(gpu_addr, Mapping{cpu_addr, size});
+    if (rasterizer) {
+        rasterizer->UpdatePagesCachedCount(cpu_addr, size, 1);
+    }
+
+    // The whole mapping is stored on the next submission
+    MarkDirty(cpu_addr, size);
+
+    const Trace::MapRecord record{
+        .gpu_addr = gpu_addr,
+        .cpu_addr = cpu_addr,
+        .size = size,
+    };
+    WriteRecord(Trace::RecordType::Map, MakePayload(record), false);
+}
+
+void GPUTraceRecorder::RecordUnmap(GPUVAddr gpu_addr, u64 size) {
+    std::scoped_lock lock{mutex};
+    if (!is_open) {
+        return;
+    }
+    EraseMappings(gpu_addr, size);
+
+    const Trace::UnmapRecord record{
+        .gpu_addr = gpu_addr,
+        .size = size,
+    };
+    WriteRecord(Trace::RecordType::Unmap, MakePayload(record), false);
+}
+
+void GPUTraceRecorder::MarkDirty(VAddr cpu_addr, u64 size) {
+    const VAddr start = Common::AlignDown(cpu_addr, Trace::PAGE_SIZE);
+    const VAddr end = Common::AlignUp(cpu_addr + size, Trace::PAGE_SIZE);
+    std::scoped_lock lock{dirty_mutex};
+    dirty_ranges.add(IntervalType{start, end});
+}
+
+void GPUTraceRecorder::RecordCommandList(const CommandList& entries) {
+    std::scoped_lock lock{mutex};
+    if (!is_open) {
+        return;
+    }
+    IntervalSet dirty;
+    {
+        std::scoped_lock dirty_lock{dirty_mutex};
+        std::swap(dirty, dirty_ranges);
+    }
+    std::vector<u8> page_payload;
+    for (const auto& [gpu_addr, mapping] : mappings) {
+        const IntervalType mapped{mapping.cpu_addr, mapping.cpu_addr + mapping.size};
+        for (const IntervalType& range : dirty & mapped) {
+            const VAddr cpu_addr = range.lower();
+            const u64 size = range.upper() - range.lower();
+            const Trace::PageHeader header{
+                .gpu_addr = gpu_addr + (cpu_addr - mapping.cpu_addr),
+                .size = size,
+            };
+            const std::size_t position = page_payload.size();
+            page_payload.resize(position + sizeof(header) + size);
+            std::memcpy(page_payload.data() + position, &header, sizeof(header));
+            cpu_memory.ReadBlockUnsafe(cpu_addr, page_payload.data() + position + sizeof(header),
+                                       size);
+        }
+    }
+    if (!page_payload.empty()) {
+        WriteRecord(Trace::RecordType::MemoryPages, std::move(page_payload), true);
+    }
+    std::vector<u8> command_payload(entries.size() * sizeof(CommandListHeader));
+    std::memcpy(command_payload.data(), entries.data(), command_payload.size());
+    WriteRecord(Trace::RecordType::CommandList, std::move(command_payload), false);
+}
+
+void GPUTraceRecorder::EraseMappings(GPUVAddr gpu_addr, u64 size) {
+    const GPUVAddr end = gpu_addr + size;
+    auto it = mappings.lower_bound(gpu_addr);
+    if (it != mappings.begin() && std::prev(it)->first + std::prev(it)->second.size > gpu_addr) {
+        --it;
+    }
+    while (it != mappings.end() && it->first < end) {
+        const GPUVAddr map_addr = it->first;
+        const Mapping mapping = it->second;
+        const GPUVAddr map_end = map_addr + mapping.size;
+        it = mappings.erase(it);
+
+        // Keep the parts of the mapping outside of the erased range
+        const GPUVAddr erase_begin = std::max(map_addr, gpu_addr);
+        const GPUVAddr erase_end = std::min(map_end, end);
+        if (map_addr < gpu_addr) {
+            mappings.emplace(map_addr, Mapping{mapping.cpu_addr, gpu_addr - map_addr});
+        }
+        if (map_end > end) {
+            mappings.emplace(end, Mapping{mapping.cpu_addr + (end - map_addr), map_end - end});
+        }
+        if (rasterizer) {
+            rasterizer->UpdatePagesCachedCount(mapping.cpu_addr + (erase_begin - map_addr),
+                                               erase_end - erase_begin, -1);
+        }
+    }
+}
+
+void GPUTraceRecorder::WriteRecord(Trace::RecordType type, std::vector<u8>&& payload,
+                                   bool compress) {
+    worker.QueueWork([this, type, payload = std::move(payload), compress] {
+        Trace::RecordHeader header{
+            .type = type,
+            .compressed_size = 0,
+            .size = payload.size(),
+        };
+        if (!compress) {
+            file.WriteObject(header);
+            file.WriteBytes(payload.data(), payload.size());
+            return;
+        }
+        const std::vector<u8> compressed = Common::Compression::CompressDataZSTD(
+            payload.data(), payload.size(), PAGE_COMPRESSION_LEVEL);
+        header.compressed_size = static_cast<u32>(compressed.size());
+        file.WriteObject(header);
+        file.WriteBytes(compressed.data(), compressed.size());
+    });
+}
+
+GPUTraceReader::GPUTraceReader(const std::string& filename) : file{filename, "rb"} {
+    if (!file.IsOpen()) {
+        LOG_ERROR(HW_GPU, "Failed to open GPU trace file {}", filename);
+        return;
+    }
+    Trace::FileHeader header{};
+    if (file.ReadBytes(&header, sizeof(header)) != sizeof(header) ||
+        header.magic != Trace::MAGIC) {
+        LOG_ERROR(HW_GPU, "{} is not a GPU trace", filename);
+        return;
+    }
+    if (header.version != Trace::VERSION) {
+        LOG_ERROR(HW_GPU, "Unsupported GPU trace version {}", header.version);
+        return;
+    }
+    is_valid = true;
+}
+
+GPUTraceReader::~GPUTraceReader() = default;
+
+std::optional<Trace::Record> GPUTraceReader::Next() {
+    if (!is_valid) {
+        return std::nullopt;
+    }
+    Trace::RecordHeader header{};
+    if (file.ReadBytes(&header, sizeof(header)) != sizeof(header)) {
+        return std::nullopt;
+    }
+    Trace::Record record{.type = header.type};
+    const bool is_compressed = header.compressed_size != 0;
+    std::vector<u8> stored(is_compressed ? header.compressed_size : header.size);
+    if (file.ReadBytes(stored.data(), stored.size()) != stored.size()) {
+        LOG_ERROR(HW_GPU, "GPU trace is truncated");
+        is_valid = false;
+        return std::nullopt;
+    }
+    if (is_compressed) {
+        record.payload = Common::Compression::DecompressDataZSTD(stored);
+    } else {
+        record.payload = std::move(stored);
+    }
+    if (record.payload.size() != header.size) {
+        LOG_ERROR(HW_GPU, "GPU trace record has an invalid size");
+        is_valid = false;
+        return std::nullopt;
+    }
+    return record;
+}
+
+GPUTracePlayer::GPUTracePlayer(GPU& gpu_, const std::string& filename)
+    : gpu{gpu_}, reader{filename} {}
+
+GPUTracePlayer::~GPUTracePlayer() = default;
+
+bool GPUTracePlayer::Step() {
+    std::optional<Trace::Record> record = reader.Next();
+    if (!record) {
+        return false;
+    }
+    const std::vector<u8>& payload = record->payload;
+    MemoryManager& memory_manager = gpu.MemoryManager();
+
+    switch (record->type) {
+    case Trace::RecordType::Map: {
+        const auto map = ReadPayload<Trace::MapRecord>(payload, 0);
+        [[maybe_unused]] const GPUVAddr gpu_addr =
+            memory_manager.Map(map.cpu_addr, map.gpu_addr, map.size);
+        break;
+    }
+    case Trace::RecordType::Unmap: {
+        const auto unmap = ReadPayload<Trace::UnmapRecord>(payload, 0);
+        memory_manager.Unmap(unmap.gpu_addr, unmap.size);
+        break;
+    }
+    case Trace::RecordType::MemoryPages:
+        // Page records cover whole dirty ranges, each header is followed by size bytes
+        for (std::size_t offset = 0; offset + sizeof(Trace::PageHeader) <= payload.size();) {
+            const auto page = ReadPayload<Trace::PageHeader>(payload, offset);
+            offset += sizeof(Trace::PageHeader);
+            memory_manager.WriteBlock(page.gpu_addr, payload.data() + offset, page.size);
+            offset += page.size;
+        }
+        break;
+    case Trace::RecordType::CommandList: {
+        CommandList entries(payload.size() / sizeof(CommandListHeader));
+        std::memcpy(entries.data(), payload.data(), entries.size() * sizeof(CommandListHeader));
+        gpu.PushGPUEntries(std::move(entries));
+        ++num_command_lists;
+        break;
+    }
+    default:
+        LOG_ERROR(HW_GPU, "Unknown GPU trace record type {}", static_cast<u32>(record->type));
+        return false;
+    }
+    return true;
+}
+
+u64 GPUTracePlayer::Run() {
+    while (Step()) {
+    }
+    return num_command_lists;
+}
+
+} // namespace Tegra
@@ -0,0 +1,192 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <boost/icl/interval_set.hpp>
+
+#include "common/common_types.h"
+#include "common/file_util.h"
+#include "common/thread_worker.h"
+#include "video_core/dma_pusher.h"
+
+namespace Core::Memory {
+class Memory;
+}
+
+namespace VideoCore {
+class RasterizerInterface;
+}
+
+namespace Tegra {
+
+/**
+ * GPU traces are a header followed by a sequence of records. Each record is a RecordHeader and
+ * its payload, compressed with Zstandard when compressed_size is not zero.
+ */
+namespace Trace {
+
+constexpr u32 MAGIC = 0x52544759; // "YGTR"
+constexpr u32 VERSION = 2;
+constexpr std::size_t PAGE_BITS = 12;
+constexpr u64 PAGE_SIZE = 1ULL << PAGE_BITS;
+
+enum class RecordType : u32 {
+    Map,          ///< MapRecord, a GPU range has been mapped to guest memory
+    Unmap,        ///< UnmapRecord, a GPU range is no longer mapped
+    MemoryPages,  ///< Sequence of PageHeader followed by the contents of the pages
+    CommandList,  ///< Sequence of CommandListHeader submitted to the GPFIFO
+};
+
+struct FileHeader {
+    u32 magic;
+    u32 version;
+};
+static_assert(sizeof(FileHeader) == 8, "FileHeader has incorrect size");
+
+struct RecordHeader {
+    RecordType type;
+    u32 compressed_size;
+    u64 size;
+};
+static_assert(sizeof(RecordHeader) == 16, "RecordHeader has incorrect size");
+
+struct MapRecord {
+    GPUVAddr gpu_addr;
+    VAddr cpu_addr;
+    u64 size;
+};
+static_assert(sizeof(MapRecord) == 24, "MapRecord has incorrect size");
+
+struct UnmapRecord {
+    GPUVAddr gpu_addr;
+    u64 size;
+};
+static_assert(sizeof(UnmapRecord) == 16, "UnmapRecord has incorrect size");
+
+struct PageHeader {
+    GPUVAddr gpu_addr;
+    u64 size;
+};
+static_assert(sizeof(PageHeader) == 16, "PageHeader has incorrect size");
+
+/// Decompressed record read from a trace
+struct Record {
+    RecordType type;
+    std::vector<u8> payload;
+};
+
+} // namespace Trace
+
+class GPU;
+
+/**
+ * Records every command list submitted to the GPFIFO together with the guest memory it can
+ * reference. Mapped memory is marked as cached in the rasterizer so CPU writes are notified
+ * through InvalidateRegion. The first submission stores all mapped GPU memory, later submissions
+ * only store the pages written since the previous one. Compression and file writes happen on a
+ * worker thread so they don't stall the submitting thread.
+ */
+class GPUTraceRecorder final {
+public:
+    explicit GPUTraceRecorder(Core::Memory::Memory& cpu_memory, const std::string& filename);
+    ~GPUTraceRecorder();
+
+    [[nodiscard]] bool IsOpen() const {
+        return is_open;
+    }
+
+    /// Binds the rasterizer used to get notified of CPU writes to mapped memory
+    void BindRasterizer(VideoCore::RasterizerInterface& rasterizer);
+
+    void RecordMap(GPUVAddr gpu_addr, VAddr cpu_addr, u64 size);
+    void RecordUnmap(GPUVAddr gpu_addr, u64 size);
+
+    /// Notifies that the CPU has written to a region of guest memory
+    void MarkDirty(VAddr cpu_addr, u64 size);
+
+    /// Records the pages written since the last submission followed by the command list
+    void RecordCommandList(const CommandList& entries);
+
+private:
+    using IntervalSet = boost::icl::interval_set<VAddr>;
+    using IntervalType = typename IntervalSet::interval_type;
+
+    struct Mapping {
+        VAddr cpu_addr;
+        u64 size;
+    };
+
+    /// Removes the mappings overlapping a GPU range and stops tracking their guest memory
+    void EraseMappings(GPUVAddr gpu_addr, u64 size);
+
+    /// Queues a record to be compressed and written by the worker thread
+    void WriteRecord(Trace::RecordType type, std::vector<u8>&& payload, bool compress);
+
+    Core::Memory::Memory& cpu_memory;
+    VideoCore::RasterizerInterface* rasterizer = nullptr;
+    Common::FS::IOFile file; ///< Only accessed from the worker after construction
+    bool is_open = false;
+
+    std::mutex mutex;
+    std::map<GPUVAddr, Mapping> mappings;
+
+    std::mutex dirty_mutex;
+    IntervalSet dirty_ranges;
+
+    // Declared last so pending records are written before the file is closed
+    Common::ThreadWorker worker{1, "yuzu:GPUTrace"};
+};
+
+class GPUTraceReader final {
+public:
+    explicit GPUTraceReader(const std::string& filename);
+    ~GPUTraceReader();
+
+    [[nodiscard]] bool IsOpen() const {
+        return is_valid;
+    }
+
+    /// Returns the next record of the trace or std::nullopt at the end of the file
+    [[nodiscard]] std::optional<Trace::Record> Next();
+
+private:
+    Common::FS::IOFile file;
+    bool is_valid = false;
+};
+
+/**
+ * Feeds a trace through the GPU of a running system. Mappings and memory are restored through the
+ * GPU memory manager and command lists are pushed through the DMA pusher as fast as possible.
+ * The guest memory the trace was captured from has to be backed in the current process.
+ */
+class GPUTracePlayer final {
+public:
+    explicit GPUTracePlayer(GPU& gpu, const std::string& filename);
+    ~GPUTracePlayer();
+
+    [[nodiscard]] bool IsOpen() const {
+        return reader.IsOpen();
+    }
+
+    /// Executes the next record, returns false when the trace has ended
+    bool Step();
+
+    /// Executes all remaining records and returns the number of command lists submitted
+    u64 Run();
+
+private:
+    GPU& gpu;
+    GPUTraceReader reader;
+    u64 num_command_lists = 0;
+};
+
+} // namespace Tegra
@@ -6,7 +6,21 @@ get_filename_component(CONTENTS_NAME ${SOURCE_FILE} NAME)
 string(REPLACE "." "_" CONTENTS_NAME ${CONTENTS_NAME})
 string(TOUPPER ${CONTENTS_NAME} CONTENTS_NAME)
 
-file(READ ${SOURCE_FILE} CONTENTS)
+file(READ ${SOURCE_FILE} SOURCE_CONTENTS)
+
+# MSVC limits string literals to 16380 bytes, split large shaders in adjacent raw literals
+set(CHUNK_SIZE 8192)
+string(LENGTH "${SOURCE_CONTENTS}" SOURCE_LENGTH)
+set(CONTENTS "")
+set(OFFSET 0)
+while(OFFSET LESS SOURCE_LENGTH)
+    string(SUBSTRING "${SOURCE_CONTENTS}" ${OFFSET} ${CHUNK_SIZE} CHUNK)
+    if(OFFSET GREATER 0)
+        string(APPEND CONTENTS ")\"\nR\"(")
+    endif()
+    string(APPEND CONTENTS "${CHUNK}")
+    math(EXPR OFFSET "${OFFSET} + ${CHUNK_SIZE}")
+endwhile()
 
 get_filename_component(OUTPUT_DIR ${HEADER_FILE} DIRECTORY)
 make_directory(${OUTPUT_DIR})
@@ -9,6 +9,7 @@
 #include "core/hle/kernel/process.h"
 #include "core/memory.h"
 #include "video_core/gpu.h"
+#include "video_core/gpu_trace.h"
 #include "video_core/memory_manager.h"
 #include "video_core/rasterizer_interface.h"
 #include "video_core/renderer_base.h"
@@ -24,6 +25,10 @@ void MemoryManager::BindRasterizer(VideoCore::RasterizerInterface& rasterizer_)
     rasterizer = &rasterizer_;
 }
 
+void MemoryManager::BindTraceRecorder(GPUTraceRecorder* recorder) {
+    trace_recorder = recorder;
+}
+
 GPUVAddr MemoryManager::UpdateRange(GPUVAddr gpu_addr, PageEntry page_entry, std::size_t size) {
     u64 remaining_size{size};
     for (u64 offset{}; offset < size; offset += page_size) {
@@ -38,6 +43,9 @@ GPUVAddr MemoryManager::UpdateRange(GPUVAddr gpu_addr, PageEntry page_entry, std
 }
 
 GPUVAddr MemoryManager::Map(VAddr cpu_addr, GPUVAddr gpu_addr, std::size_t size) {
+    if (trace_recorder) {
+        trace_recorder->RecordMap(gpu_addr, cpu_addr, size);
+    }
     return UpdateRange(gpu_addr, cpu_addr, size);
 }
 
@@ -59,6 +67,9 @@ void MemoryManager::Unmap(GPUVAddr gpu_addr, std::size_t size) {
     // Flush and invalidate through the GPU interface, to be asynchronous if possible.
     system.GPU().FlushAndInvalidateRegion(*GpuToCpuAddress(gpu_addr), size);
 
+    if (trace_recorder) {
+        trace_recorder->RecordUnmap(gpu_addr, size);
+    }
     UpdateRange(gpu_addr, PageEntry::State::Unmapped, size);
 }
 
@@ -108,6 +119,9 @@ void MemoryManager::UnmapVicFrame(GPUVAddr gpu_addr, std::size_t size) {
     system.GPU().Renderer().Rasterizer().InvalidateExceptTextureCache(*cpu_addr, size);
     cache_invalidate_queue.push_back({*cpu_addr, size});
 
+    if (trace_recorder) {
+        trace_recorder->RecordUnmap(gpu_addr, size);
+    }
     UpdateRange(gpu_addr, PageEntry::State::Unmapped, size);
 }
 
@@ -20,6 +20,8 @@ class System;
 
 namespace Tegra {
 
+class GPUTraceRecorder;
+
 class PageEntry final {
 public:
     enum class State : u32 {
@@ -74,6 +76,9 @@ public:
     /// Binds a renderer to the memory manager.
     void BindRasterizer(VideoCore::RasterizerInterface& rasterizer);
 
+    /// Binds a recorder notified of every mapping change, nullptr to stop recording.
+    void BindTraceRecorder(GPUTraceRecorder* recorder);
+
     [[nodiscard]] std::optional<VAddr> GpuToCpuAddress(GPUVAddr addr) const;
 
     template <typename T>
@@ -156,6 +161,7 @@ private:
     Core::System& system;
 
     VideoCore::RasterizerInterface* rasterizer = nullptr;
+    GPUTraceRecorder* trace_recorder = nullptr;
 
     std::vector<PageEntry> page_table;
     std::vector<std::pair<VAddr, std::size_t>> cache_invalidate_queue;
@@ -0,0 +1,123 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "common/logging/log.h"
+#include "video_core/gpu.h"
+#include "video_core/memory_manager.h"
+#include "video_core/renderer_null/null_rasterizer.h"
+
+namespace Null {
+
+namespace {
+
+void Increment(std::atomic<u64>& counter) {
+    counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+u64 Take(std::atomic<u64>& counter) {
+    return counter.exchange(0, std::memory_order_relaxed);
+}
+
+} // Anonymous namespace
+
+RasterizerNull::RasterizerNull(Core::Memory::Memory& cpu_memory, Tegra::GPU& gpu_)
+    : RasterizerAccelerated{cpu_memory}, gpu{gpu_}, gpu_memory{gpu_.MemoryManager()} {}
+
+RasterizerNull::~RasterizerNull() = default;
+
+void RasterizerNull::Draw(bool is_indexed, bool is_instanced) {
+    Increment(current.draws);
+}
+
+void RasterizerNull::Clear() {
+    Increment(current.clears);
+}
+
+void RasterizerNull::DispatchCompute(GPUVAddr code_addr) {
+    Increment(current.dispatches);
+}
+
+void RasterizerNull::ResetCounter(VideoCore::QueryType type) {}
+
+void RasterizerNull::Query(GPUVAddr gpu_addr, VideoCore::QueryType type,
+                           std::optional<u64> timestamp) {
+    Increment(current.queries);
+
+    // Nothing is rasterized, report every sample as passed so occlusion tests keep drawing
+    gpu_memory.Write<u64>(gpu_addr, 1);
+    if (timestamp) {
+        gpu_memory.Write<u64>(gpu_addr + 8, *timestamp);
+    }
+}
+
+void RasterizerNull::SignalSemaphore(GPUVAddr addr, u32 value) {
+    Increment(current.semaphores);
+
+    // There is no host work to wait for, fences are signalled immediately
+    gpu_memory.Write<u32>(addr, value);
+}
+
+void RasterizerNull::SignalSyncPoint(u32 value) {
+    Increment(current.sync_points);
+    gpu.IncrementSyncPoint(value);
+}
+
+void RasterizerNull::ReleaseFences() {}
+
+void RasterizerNull::FlushAll() {}
+
+void RasterizerNull::FlushRegion(VAddr addr, u64 size) {
+    Increment(current.flushes);
+}
+
+void RasterizerNull::InvalidateExceptTextureCache(VAddr addr, u64 size) {
+    Increment(current.invalidations);
+}
+
+void RasterizerNull::InvalidateTextureCache(VAddr addr, u64 size) {
+    Increment(current.invalidations);
+}
+
+bool RasterizerNull::MustFlushRegion(VAddr addr, u64 size) {
+    return false;
+}
+
+void RasterizerNull::InvalidateRegion(VAddr addr, u64 size) {
+    Increment(current.invalidations);
+}
+
+void RasterizerNull::OnCPUWrite(VAddr addr, u64 size) {
+    Increment(current.invalidations);
+}
+
+void RasterizerNull::SyncGuestHost() {}
+
+void RasterizerNull::FlushAndInvalidateRegion(VAddr addr, u64 size) {
+    Increment(current.flushes);
+    Increment(current.invalidations);
+}
+
+void RasterizerNull::WaitForIdle() {}
+
+void RasterizerNull::FlushCommands() {}
+
+void RasterizerNull::TickFrame() {
+    const FrameCounters frame{
+        .draws = Take(current.draws),
+        .clears = Take(current.clears),
+        .dispatches = Take(current.dispatches),
+        .queries = Take(current.queries),
+        .semaphores = Take(current.semaphores),
+        .sync_points = Take(current.sync_points),
+        .flushes = Take(current.flushes),
+        .invalidations = Take(current.invalidations),
+    };
+    LOG_DEBUG(Render,
+              "Frame counters: draws={} clears={} dispatches={} queries={} semaphores={} "
+              "sync_points={} flushes={} invalidations={}",
+              frame.draws, frame.clears, frame.dispatches, frame.queries, frame.semaphores,
+              frame.sync_points, frame.flushes, frame.invalidations);
+}
+
+} // namespace Null
@@ -0,0 +1,88 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+
+#include "common/common_types.h"
+#include "video_core/rasterizer_accelerated.h"
+
+namespace Core::Memory {
+class Memory;
+}
+
+namespace Tegra {
+class GPU;
+class MemoryManager;
+} // namespace Tegra
+
+namespace Null {
+
+/// Number of rasterizer operations requested by the guest during a single frame
+struct FrameCounters {
+    u64 draws{};
+    u64 clears{};
+    u64 dispatches{};
+    u64 queries{};
+    u64 semaphores{};
+    u64 sync_points{};
+    u64 flushes{};
+    u64 invalidations{};
+};
+
+/**
+ * Rasterizer that consumes every command without submitting work to a host graphics API.
+ * Only the engines, DMA pusher and macro processing are measured. There is no texture or buffer
+ * cache behind it, so surface lookups, unswizzling and buffer uploads are not exercised; cache
+ * operations are only counted.
+ */
+class RasterizerNull final : public VideoCore::RasterizerAccelerated {
+public:
+    explicit RasterizerNull(Core::Memory::Memory& cpu_memory, Tegra::GPU& gpu);
+    ~RasterizerNull() override;
+
+    void Draw(bool is_indexed, bool is_instanced) override;
+    void Clear() override;
+    void DispatchCompute(GPUVAddr code_addr) override;
+    void ResetCounter(VideoCore::QueryType type) override;
+    void Query(GPUVAddr gpu_addr, VideoCore::QueryType type,
+               std::optional<u64> timestamp) override;
+    void SignalSemaphore(GPUVAddr addr, u32 value) override;
+    void SignalSyncPoint(u32 value) override;
+    void ReleaseFences() override;
+    void FlushAll() override;
+    void FlushRegion(VAddr addr, u64 size) override;
+    void InvalidateExceptTextureCache(VAddr addr, u64 size) override;
+    void InvalidateTextureCache(VAddr addr, u64 size) override;
+    bool MustFlushRegion(VAddr addr, u64 size) override;
+    void InvalidateRegion(VAddr addr, u64 size) override;
+    void OnCPUWrite(VAddr addr, u64 size) override;
+    void SyncGuestHost() override;
+    void FlushAndInvalidateRegion(VAddr addr, u64 size) override;
+    void WaitForIdle() override;
+    void FlushCommands() override;
+    void TickFrame() override;
+
+private:
+    struct AtomicCounters {
+        std::atomic<u64> draws{};
+        std::atomic<u64> clears{};
+        std::atomic<u64> dispatches{};
+        std::atomic<u64> queries{};
+        std::atomic<u64> semaphores{};
+        std::atomic<u64> sync_points{};
+        std::atomic<u64> flushes{};
+        std::atomic<u64> invalidations{};
+    };
+
+    Tegra::GPU& gpu;
+    Tegra::MemoryManager& gpu_memory;
+
+    // Invalidations and flushes come from CPU threads while draws come from the GPU thread
+    AtomicCounters current;
+};
+
+} // namespace Null
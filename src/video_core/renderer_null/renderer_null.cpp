@@ -0,0 +1,46 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <memory>
+
+#include "common/logging/log.h"
+#include "core/frontend/emu_window.h"
+#include "video_core/renderer_null/renderer_null.h"
+
+namespace Null {
+
+RendererNull::RendererNull(Core::Frontend::EmuWindow& emu_window, Core::Memory::Memory& cpu_memory_,
+                           Tegra::GPU& gpu_,
+                           std::unique_ptr<Core::Frontend::GraphicsContext> context)
+    : RendererBase{emu_window, std::move(context)}, cpu_memory{cpu_memory_}, gpu{gpu_} {}
+
+RendererNull::~RendererNull() = default;
+
+bool RendererNull::Init() {
+    rasterizer = std::make_unique<RasterizerNull>(cpu_memory, gpu);
+    LOG_INFO(Render, "Null renderer initialized, no host graphics API will be used");
+    return true;
+}
+
+void RendererNull::ShutDown() {}
+
+void RendererNull::SwapBuffers(const Tegra::FramebufferConfig* framebuffer) {
+    if (!framebuffer) {
+        return;
+    }
+
+    // Screenshots can't be taken, complete the request so callers don't wait forever
+    if (renderer_settings.screenshot_requested) {
+        renderer_settings.screenshot_complete_callback();
+        renderer_settings.screenshot_requested = false;
+    }
+
+    ++m_current_frame;
+
+    rasterizer->TickFrame();
+
+    render_window.PollEvents();
+}
+
+} // namespace Null
@@ -0,0 +1,46 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+
+#include "video_core/renderer_base.h"
+#include "video_core/renderer_null/null_rasterizer.h"
+
+namespace Core::Frontend {
+class EmuWindow;
+}
+
+namespace Core::Memory {
+class Memory;
+}
+
+namespace Tegra {
+class GPU;
+}
+
+namespace Null {
+
+/**
+ * Renderer that runs the whole guest command processing without a host graphics API.
+ * Used to measure the CPU side of GPU emulation on machines without a GPU.
+ */
+class RendererNull final : public VideoCore::RendererBase {
+public:
+    explicit RendererNull(Core::Frontend::EmuWindow& emu_window, Core::Memory::Memory& cpu_memory,
+                          Tegra::GPU& gpu,
+                          std::unique_ptr<Core::Frontend::GraphicsContext> context);
+    ~RendererNull() override;
+
+    bool Init() override;
+    void ShutDown() override;
+    void SwapBuffers(const Tegra::FramebufferConfig* framebuffer) override;
+
+private:
+    Core::Memory::Memory& cpu_memory;
+    Tegra::GPU& gpu;
+};
+
+} // namespace Null
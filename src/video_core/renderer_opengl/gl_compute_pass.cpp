@@ -0,0 +1,178 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+#include <glad/glad.h>
+
+#include "common/alignment.h"
+#include "common/assert.h"
+#include "common/bit_util.h"
+#include "common/common_types.h"
+#include "video_core/host_shaders/opengl_astc_decoder_comp.h"
+#include "video_core/host_shaders/opengl_block_linear_unswizzle_comp.h"
+#include "video_core/host_shaders/opengl_convert_s8d24_comp.h"
+#include "video_core/renderer_opengl/gl_compute_pass.h"
+#include "video_core/renderer_opengl/gl_resource_manager.h"
+
+namespace OpenGL {
+
+namespace {
+
+constexpr u32 GOB_SIZE_X = 64;
+constexpr u32 GOB_SIZE_Y = 8;
+
+// Workgroup sizes, keep in sync with the host shaders
+constexpr u32 UNSWIZZLE_GROUP_X = 32;
+constexpr u32 UNSWIZZLE_GROUP_Y = 8;
+constexpr u32 S8D24_GROUP_X = 256;
+constexpr u32 ASTC_GROUP_X = 8;
+constexpr u32 ASTC_GROUP_Y = 8;
+
+// Smallest GL_MAX_COMPUTE_WORK_GROUP_COUNT the specification guarantees on each dimension
+constexpr u32 MAX_GROUPS_X = 65535;
+
+constexpr u32 DivCeil(u32 value, u32 divisor) {
+    return (value + divisor - 1) / divisor;
+}
+
+/// Restores the storage buffer bindings clobbered by a pass. Surfaces are loaded while a draw is
+/// being set up, so guest buffers may already be bound to them.
+class ScopedStorageBindings {
+public:
+    explicit ScopedStorageBindings(GLuint num_bindings_) : num_bindings{num_bindings_} {
+        ASSERT(num_bindings <= MAX_BINDINGS);
+        for (GLuint index = 0; index < num_bindings; ++index) {
+            glGetIntegeri_v(GL_SHADER_STORAGE_BUFFER_BINDING, index, &buffers[index]);
+            glGetInteger64i_v(GL_SHADER_STORAGE_BUFFER_START, index, &offsets[index]);
+            glGetInteger64i_v(GL_SHADER_STORAGE_BUFFER_SIZE, index, &sizes[index]);
+        }
+    }
+
+    ~ScopedStorageBindings() {
+        for (GLuint index = 0; index < num_bindings; ++index) {
+            const GLuint buffer = static_cast<GLuint>(buffers[index]);
+            if (buffer == 0 || sizes[index] == 0) {
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, buffer);
+            } else {
+                glBindBufferRange(GL_SHADER_STORAGE_BUFFER, index, buffer,
+                                  static_cast<GLintptr>(offsets[index]),
+                                  static_cast<GLsizeiptr>(sizes[index]));
+            }
+        }
+    }
+
+private:
+    static constexpr GLuint MAX_BINDINGS = 2;
+
+    GLuint num_bindings;
+    std::array<GLint, MAX_BINDINGS> buffers{};
+    std::array<GLint64, MAX_BINDINGS> offsets{};
+    std::array<GLint64, MAX_BINDINGS> sizes{};
+};
+
+} // Anonymous namespace
+
+ComputePass::ComputePass(std::string_view source) {
+    OGLShader shader;
+    shader.Create(source, GL_COMPUTE_SHADER);
+    program.Create(false, false, shader.handle);
+}
+
+ComputePass::~ComputePass() = default;
+
+void ComputePass::Dispatch(u32 groups_x, u32 groups_y, u32 groups_z) const {
+    // Guest programs are rebound before each draw and dispatch, leave no program bound so the
+    // graphics pipeline object is used again
+    glUseProgram(program.handle);
+    glDispatchCompute(groups_x, groups_y, groups_z);
+    glUseProgram(0);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_PIXEL_BUFFER_BARRIER_BIT);
+}
+
+BlockLinearUnswizzlePass::BlockLinearUnswizzlePass()
+    : ComputePass(HostShaders::OPENGL_BLOCK_LINEAR_UNSWIZZLE_COMP) {}
+
+BlockLinearUnswizzlePass::~BlockLinearUnswizzlePass() = default;
+
+void BlockLinearUnswizzlePass::Unswizzle(GLuint src_buffer, std::size_t src_offset,
+                                         GLuint dst_buffer, std::size_t dst_offset,
+                                         u32 bytes_per_block, u32 width, u32 height, u32 depth,
+                                         u32 block_height, u32 block_depth,
+                                         u32 width_spacing) const {
+    const u32 row_bytes = width * bytes_per_block;
+    ASSERT(row_bytes % 4 == 0 && src_offset % 4 == 0 && dst_offset % 4 == 0);
+
+    const u32 gob_elements_x = GOB_SIZE_X / bytes_per_block;
+    const u32 aligned_width = Common::AlignUp(width, gob_elements_x * width_spacing);
+    const u32 blocks_on_x = aligned_width / gob_elements_x;
+    const u32 blocks_on_y = DivCeil(height, GOB_SIZE_Y << block_height);
+    const u32 row_words = row_bytes / 4;
+
+    const ScopedStorageBindings bindings{2};
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, src_buffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, dst_buffer);
+    glProgramUniform1ui(program.handle, 0, static_cast<GLuint>(src_offset / 4));
+    glProgramUniform1ui(program.handle, 1, static_cast<GLuint>(dst_offset / 4));
+    glProgramUniform3ui(program.handle, 2, row_words, height, depth);
+    glProgramUniform2ui(program.handle, 3, block_height, block_depth);
+    glProgramUniform2ui(program.handle, 4, blocks_on_x, blocks_on_y);
+    Dispatch(DivCeil(row_words, UNSWIZZLE_GROUP_X), DivCeil(height, UNSWIZZLE_GROUP_Y), depth);
+}
+
+S8D24ConvertPass::S8D24ConvertPass() : ComputePass(HostShaders::OPENGL_CONVERT_S8D24_COMP) {}
+
+S8D24ConvertPass::~S8D24ConvertPass() = default;
+
+void S8D24ConvertPass::Convert(GLuint buffer, std::size_t offset, u32 num_texels) const {
+    ASSERT(offset % 4 == 0);
+    const ScopedStorageBindings bindings{1};
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, buffer);
+    glProgramUniform1ui(program.handle, 0, static_cast<GLuint>(offset / 4));
+    glProgramUniform1ui(program.handle, 1, num_texels);
+    const u32 num_groups = DivCeil(num_texels, S8D24_GROUP_X);
+    const u32 groups_x = std::min(num_groups, MAX_GROUPS_X);
+    Dispatch(groups_x, DivCeil(num_groups, groups_x), 1);
+}
+
+ASTCDecoderPass::ASTCDecoderPass() : ComputePass(HostShaders::OPENGL_ASTC_DECODER_COMP) {}
+
+ASTCDecoderPass::~ASTCDecoderPass() = default;
+
+void ASTCDecoderPass::Decode(GLuint src_buffer, std::size_t src_offset, GLuint dst_buffer,
+                             std::size_t dst_offset, u32 width, u32 height, u32 depth,
+                             u32 block_width, u32 block_height) const {
+    ASSERT(src_offset % 16 == 0 && dst_offset % 4 == 0);
+    const ScopedStorageBindings bindings{2};
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, src_buffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, dst_buffer);
+    glProgramUniform1ui(program.handle, 0, static_cast<GLuint>(src_offset / 16));
+    glProgramUniform1ui(program.handle, 1, static_cast<GLuint>(dst_offset / 4));
+    glProgramUniform3ui(program.handle, 2, width, height, depth);
+    glProgramUniform2ui(program.handle, 3, block_width, block_height);
+    Dispatch(DivCeil(DivCeil(width, block_width), ASTC_GROUP_X),
+             DivCeil(DivCeil(height, block_height), ASTC_GROUP_Y), depth);
+}
+
+TextureDecodePasses::TextureDecodePasses() = default;
+
+TextureDecodePasses::~TextureDecodePasses() = default;
+
+GLuint TextureDecodePasses::ScratchBuffer(std::size_t index, std::size_t size) {
+    OGLBuffer& buffer = scratch_buffers[index];
+    if (scratch_sizes[index] < size) {
+        // Grow in powers of two to avoid recreating buffers for every new surface size
+        const std::size_t new_size = std::size_t{1} << Common::Log2Ceil64(size);
+        buffer.Release();
+        buffer.Create();
+        glNamedBufferStorage(buffer.handle, static_cast<GLsizeiptr>(new_size), nullptr,
+                             GL_DYNAMIC_STORAGE_BIT);
+        scratch_sizes[index] = new_size;
+    }
+    return buffer.handle;
+}
+
+} // namespace OpenGL
@@ -0,0 +1,83 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include <glad/glad.h>
+
+#include "common/common_types.h"
+#include "video_core/renderer_opengl/gl_resource_manager.h"
+
+namespace OpenGL {
+
+class ComputePass {
+public:
+    explicit ComputePass(std::string_view source);
+    ~ComputePass();
+
+protected:
+    /// Dispatches the pass and makes its writes visible to shader storage and pixel transfers
+    void Dispatch(u32 groups_x, u32 groups_y, u32 groups_z) const;
+
+    OGLProgram program;
+};
+
+/// Unswizzles block linear images to a pitch linear layout.
+class BlockLinearUnswizzlePass final : public ComputePass {
+public:
+    explicit BlockLinearUnswizzlePass();
+    ~BlockLinearUnswizzlePass();
+
+    /// Unswizzles an image, width and height are in blocks and block_height and block_depth are
+    /// log2 GOB counts. Rows have to be a multiple of 4 bytes.
+    void Unswizzle(GLuint src_buffer, std::size_t src_offset, GLuint dst_buffer,
+                   std::size_t dst_offset, u32 bytes_per_block, u32 width, u32 height, u32 depth,
+                   u32 block_height, u32 block_depth, u32 width_spacing) const;
+};
+
+/// Converts S8Z24 depth stencil texels to the Z24S8 layout in place.
+class S8D24ConvertPass final : public ComputePass {
+public:
+    explicit S8D24ConvertPass();
+    ~S8D24ConvertPass();
+
+    void Convert(GLuint buffer, std::size_t offset, u32 num_texels) const;
+};
+
+/// Decodes pitch linear ASTC LDR blocks to RGBA8.
+class ASTCDecoderPass final : public ComputePass {
+public:
+    explicit ASTCDecoderPass();
+    ~ASTCDecoderPass();
+
+    void Decode(GLuint src_buffer, std::size_t src_offset, GLuint dst_buffer,
+                std::size_t dst_offset, u32 width, u32 height, u32 depth, u32 block_width,
+                u32 block_height) const;
+};
+
+/// Compute passes and scratch memory used to decode guest textures on the host GPU.
+class TextureDecodePasses {
+public:
+    static constexpr std::size_t NUM_SCRATCH_BUFFERS = 3;
+
+    explicit TextureDecodePasses();
+    ~TextureDecodePasses();
+
+    /// Returns a scratch storage buffer of at least the given size in bytes
+    GLuint ScratchBuffer(std::size_t index, std::size_t size);
+
+    BlockLinearUnswizzlePass block_linear_unswizzle;
+    S8D24ConvertPass s8d24_convert;
+    ASTCDecoderPass astc_decoder;
+
+private:
+    std::array<OGLBuffer, NUM_SCRATCH_BUFFERS> scratch_buffers;
+    std::array<std::size_t, NUM_SCRATCH_BUFFERS> scratch_sizes{};
+};
+
+} // namespace OpenGL
@@ -112,6 +112,10 @@ public:
         return use_asynchronous_shaders;
     }
 
+    bool UseAcceleratedTextureDecoding() const {
+        return use_accelerated_texture_decoding;
+    }
+
 private:
     static bool TestVariableAoffi();
     static bool TestPreciseBug();
@@ -137,6 +141,7 @@ private:
     bool has_nv_viewport_array2{};
     bool use_assembly_shaders{};
     bool use_asynchronous_shaders{};
+    bool use_accelerated_texture_decoding{};
 };
 
 } // namespace OpenGL
@@ -337,17 +337,12 @@ void ShaderCacheOpenGL::LoadDiskCache(u64 title_id, const std::atomic_bool& stop
         return;
     }
 
-    std::vector<ShaderDiskCachePrecompiled> gl_cache;
     if (!device.UseAssemblyShaders()) {
         // Only load precompiled cache when we are not using assembly shaders
-        gl_cache = disk_cache.LoadPrecompiled();
+        disk_cache.LoadPrecompiled();
     }
     const auto supported_formats = GetSupportedFormats();
 
-    // Track if precompiled cache was altered during loading to know if we have to
-    // serialize the virtual precompiled cache file back to the hard drive
-    bool precompiled_cache_altered = false;
-
     // Inform the frontend about shader build initialization
     if (callback) {
         callback(VideoCore::LoadCallbackStage::Build, 0, transferable->size());
@@ -357,11 +352,6 @@ void ShaderCacheOpenGL::LoadDiskCache(u64 title_id, const std::atomic_bool& stop
     std::size_t built_shaders = 0; // It doesn't have be atomic since it's used behind a mutex
     std::atomic_bool gl_cache_failed = false;
 
-    const auto find_precompiled = [&gl_cache](u64 id) {
-        return std::find_if(gl_cache.begin(), gl_cache.end(),
-                            [id](const auto& entry) { return entry.unique_identifier == id; });
-    };
-
     const auto worker = [&](Core::Frontend::GraphicsContext* context, std::size_t begin,
                             std::size_t end) {
         const auto scope = context->Acquire();
@@ -372,8 +362,6 @@ void ShaderCacheOpenGL::LoadDiskCache(u64 title_id, const std::atomic_bool& stop
             }
             const auto& entry = (*transferable)[i];
             const u64 uid = entry.unique_identifier;
-            const auto it = find_precompiled(uid);
-            const auto precompiled_entry = it != gl_cache.end() ? &*it : nullptr;
 
             const bool is_compute = entry.type == ShaderType::Compute;
             const u32 main_offset = is_compute ? KERNEL_MAIN_OFFSET : STAGE_MAIN_OFFSET;
@@ -381,9 +369,13 @@ void ShaderCacheOpenGL::LoadDiskCache(u64 title_id, const std::atomic_bool& stop
             const ShaderIR ir(entry.code, main_offset, COMPILER_SETTINGS, *registry);
 
             ProgramSharedPtr program;
-            if (precompiled_entry) {
+            if (disk_cache.HasPrecompiled(uid)) {
                 // If the shader is precompiled, attempt to load it with
-                program = GeneratePrecompiledProgram(entry, *precompiled_entry, supported_formats);
+                const auto precompiled_entry = disk_cache.LoadPrecompiledEntry(uid);
+                if (precompiled_entry) {
+                    program =
+                        GeneratePrecompiledProgram(entry, *precompiled_entry, supported_formats);
+                }
                 if (!program) {
                     gl_cache_failed = true;
                 }
@@ -427,7 +419,6 @@ void ShaderCacheOpenGL::LoadDiskCache(u64 title_id, const std::atomic_bool& stop
     if (gl_cache_failed) {
         // Invalidate the precompiled cache if a shader dumped shader was rejected
         disk_cache.InvalidatePrecompiled();
-        precompiled_cache_altered = true;
         return;
     }
     if (stop_loading) {
@@ -444,17 +435,13 @@ void ShaderCacheOpenGL::LoadDiskCache(u64 title_id, const std::atomic_bool& stop
 
     for (std::size_t i = 0; i < transferable->size(); ++i) {
         const u64 id = (*transferable)[i].unique_identifier;
-        const auto it = find_precompiled(id);
-        if (it == gl_cache.end()) {
+        if (!disk_cache.HasPrecompiled(id)) {
             const GLuint program = runtime_cache.at(id).program->source_program.handle;
             disk_cache.SavePrecompiled(id, program);
-            precompiled_cache_altered = true;
         }
     }
 
-    if (precompiled_cache_altered) {
-        disk_cache.SaveVirtualPrecompiledFile();
-    }
+    disk_cache.FlushPrecompiled();
 }
 
 ProgramSharedPtr ShaderCacheOpenGL::GeneratePrecompiledProgram(
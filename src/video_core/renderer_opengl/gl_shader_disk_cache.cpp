@@ -60,6 +60,26 @@ struct BindlessSamplerEntry {
 
 constexpr u32 NativeVersion = 21;
 
+constexpr u32 PrecompiledMagic = Common::MakeMagic('Y', 'G', 'P', 'C');
+
+/// Header at the beginning of the precompiled file, followed by the appended entries
+struct PrecompiledFileHeader {
+    u32 magic = 0;
+    u32 reserved = 0;
+    ShaderCacheVersionHash version_hash{};
+};
+static_assert(sizeof(PrecompiledFileHeader) == 72, "PrecompiledFileHeader has wrong size");
+
+/// Header of a precompiled entry, followed by its Zstandard compressed program binary
+struct PrecompiledEntryHeader {
+    u64 unique_identifier = 0;
+    GLenum binary_format = 0;
+    u32 binary_size = 0;
+    u32 compressed_size = 0;
+    u32 reserved = 0;
+};
+static_assert(sizeof(PrecompiledEntryHeader) == 24, "PrecompiledEntryHeader has wrong size");
+
 ShaderCacheVersionHash GetShaderCacheVersionHash() {
     ShaderCacheVersionHash hash{};
     const std::size_t length = std::min(std::strlen(Common::g_shader_cache_version), hash.size());
@@ -261,63 +281,90 @@ std::optional<std::vector<ShaderDiskCacheEntry>> ShaderDiskCacheOpenGL::LoadTran
     return {std::move(entries)};
 }
 
-std::vector<ShaderDiskCachePrecompiled> ShaderDiskCacheOpenGL::LoadPrecompiled() {
+void ShaderDiskCacheOpenGL::LoadPrecompiled() {
     if (!is_usable) {
-        return {};
+        return;
     }
 
-    Common::FS::IOFile file(GetPrecompiledPath(), "rb");
-    if (!file.IsOpen()) {
+    precompiled_file = Common::MappedFile(GetPrecompiledPath());
+    if (!precompiled_file.IsOpen()) {
         LOG_INFO(Render_OpenGL, "No precompiled shader cache found");
-        return {};
+        return;
     }
 
-    if (const auto result = LoadPrecompiledFile(file)) {
-        return *result;
+    if (IndexPrecompiledFile()) {
+        return;
     }
 
     LOG_INFO(Render_OpenGL, "Failed to load precompiled cache");
-    file.Close();
     InvalidatePrecompiled();
-    return {};
 }
 
-std::optional<std::vector<ShaderDiskCachePrecompiled>> ShaderDiskCacheOpenGL::LoadPrecompiledFile(
-    Common::FS::IOFile& file) {
-    // Read compressed file from disk and decompress to virtual precompiled cache file
-    std::vector<u8> compressed(file.GetSize());
-    file.ReadBytes(compressed.data(), compressed.size());
-    const std::vector<u8> decompressed = Common::Compression::DecompressDataZSTD(compressed);
-    SaveArrayToPrecompiled(decompressed.data(), decompressed.size());
-    precompiled_cache_virtual_file_offset = 0;
-
-    ShaderCacheVersionHash file_hash{};
-    if (!LoadArrayFromPrecompiled(file_hash.data(), file_hash.size())) {
-        precompiled_cache_virtual_file_offset = 0;
+bool ShaderDiskCacheOpenGL::HasPrecompiled(u64 unique_identifier) const {
+    return precompiled_index.find(unique_identifier) != precompiled_index.end();
+}
+
+std::optional<ShaderDiskCachePrecompiled> ShaderDiskCacheOpenGL::LoadPrecompiledEntry(
+    u64 unique_identifier) const {
+    const auto it = precompiled_index.find(unique_identifier);
+    if (it == precompiled_index.end() || !precompiled_file.IsOpen()) {
         return std::nullopt;
     }
-    if (GetShaderCacheVersionHash() != file_hash) {
-        LOG_INFO(Render_OpenGL, "Precompiled cache is from another version of the emulator");
-        precompiled_cache_virtual_file_offset = 0;
+
+    const PrecompiledLocation& location = it->second;
+    std::vector<u8> binary = Common::Compression::DecompressDataZSTD(
+        precompiled_file.Data() + location.offset, location.compressed_size);
+    if (binary.size() != location.binary_size) {
         return std::nullopt;
     }
+    return ShaderDiskCachePrecompiled{
+        .unique_identifier = unique_identifier,
+        .binary_format = location.binary_format,
+        .binary = std::move(binary),
+    };
+}
 
-    std::vector<ShaderDiskCachePrecompiled> entries;
-    while (precompiled_cache_virtual_file_offset < precompiled_cache_virtual_file.GetSize()) {
-        u32 binary_size;
-        auto& entry = entries.emplace_back();
-        if (!LoadObjectFromPrecompiled(entry.unique_identifier) ||
-            !LoadObjectFromPrecompiled(entry.binary_format) ||
-            !LoadObjectFromPrecompiled(binary_size)) {
-            return std::nullopt;
+bool ShaderDiskCacheOpenGL::IndexPrecompiledFile() {
+    const u8* const data = precompiled_file.Data();
+    const std::size_t size = precompiled_file.Size();
+
+    PrecompiledFileHeader file_header;
+    if (size < sizeof(file_header)) {
+        return false;
+    }
+    std::memcpy(&file_header, data, sizeof(file_header));
+    if (file_header.magic != PrecompiledMagic) {
+        LOG_INFO(Render_OpenGL, "Precompiled cache has an unknown format");
+        return false;
+    }
+    if (file_header.version_hash != GetShaderCacheVersionHash()) {
+        LOG_INFO(Render_OpenGL, "Precompiled cache is from another version of the emulator");
+        return false;
+    }
+
+    // Only the entry headers are read here, binaries are decompressed on demand
+    std::size_t offset = sizeof(file_header);
+    while (offset < size) {
+        PrecompiledEntryHeader entry_header;
+        if (size - offset < sizeof(entry_header)) {
+            return false;
         }
+        std::memcpy(&entry_header, data + offset, sizeof(entry_header));
+        offset += sizeof(entry_header);
 
-        entry.binary.resize(binary_size);
-        if (!LoadArrayFromPrecompiled(entry.binary.data(), entry.binary.size())) {
-            return std::nullopt;
+        if (size - offset < entry_header.compressed_size) {
+            return false;
         }
+        precompiled_index.insert_or_assign(entry_header.unique_identifier,
+                                           PrecompiledLocation{
+                                               .offset = offset,
+                                               .compressed_size = entry_header.compressed_size,
+                                               .binary_size = entry_header.binary_size,
+                                               .binary_format = entry_header.binary_format,
+                                           });
+        offset += entry_header.compressed_size;
     }
-    return entries;
+    return true;
 }
 
 void ShaderDiskCacheOpenGL::InvalidateTransferable() {
@@ -329,8 +376,10 @@ void ShaderDiskCacheOpenGL::InvalidateTransferable() {
 }
 
 void ShaderDiskCacheOpenGL::InvalidatePrecompiled() {
-    // Clear virtaul precompiled cache file
-    precompiled_cache_virtual_file.Resize(0);
+    // Release the mapping so the file can be deleted and drop everything that points into it
+    precompiled_file.Close();
+    precompiled_index.clear();
+    pending_precompiled.clear();
 
     if (!Common::FS::Delete(GetPrecompiledPath())) {
         LOG_ERROR(Render_OpenGL, "Failed to invalidate precompiled file={}", GetPrecompiledPath());
@@ -367,13 +416,6 @@ void ShaderDiskCacheOpenGL::SavePrecompiled(u64 unique_identifier, GLuint progra
         return;
     }
 
-    // TODO(Rodrigo): This is a design smell. I shouldn't be having to manually write the header
-    // when writing the dump. This should be done the moment I get access to write to the virtual
-    // file.
-    if (precompiled_cache_virtual_file.GetSize() == 0) {
-        SavePrecompiledHeaderToVirtualPrecompiledCache();
-    }
-
     GLint binary_length;
     glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binary_length);
 
@@ -381,13 +423,62 @@ void ShaderDiskCacheOpenGL::SavePrecompiled(u64 unique_identifier, GLuint progra
     std::vector<u8> binary(binary_length);
     glGetProgramBinary(program, binary_length, nullptr, &binary_format, binary.data());
 
-    if (!SaveObjectToPrecompiled(unique_identifier) || !SaveObjectToPrecompiled(binary_format) ||
-        !SaveObjectToPrecompiled(static_cast<u32>(binary.size())) ||
-        !SaveArrayToPrecompiled(binary.data(), binary.size())) {
-        LOG_ERROR(Render_OpenGL, "Failed to save binary program file in shader={:016X}, removing",
+    const std::vector<u8> compressed =
+        Common::Compression::CompressDataZSTDDefault(binary.data(), binary.size());
+    if (compressed.empty()) {
+        LOG_ERROR(Render_OpenGL, "Failed to compress binary program in shader={:016X}",
                   unique_identifier);
-        InvalidatePrecompiled();
+        return;
     }
+
+    const PrecompiledEntryHeader entry_header{
+        .unique_identifier = unique_identifier,
+        .binary_format = binary_format,
+        .binary_size = static_cast<u32>(binary.size()),
+        .compressed_size = static_cast<u32>(compressed.size()),
+    };
+    const auto* const header_bytes = reinterpret_cast<const u8*>(&entry_header);
+    pending_precompiled.insert(pending_precompiled.end(), header_bytes,
+                               header_bytes + sizeof(entry_header));
+    pending_precompiled.insert(pending_precompiled.end(), compressed.begin(), compressed.end());
+}
+
+void ShaderDiskCacheOpenGL::FlushPrecompiled() {
+    // Mapped files can't be extended on every platform, the mapping is only needed while loading
+    precompiled_file.Close();
+    if (pending_precompiled.empty()) {
+        return;
+    }
+
+    if (!EnsureDirectories()) {
+        return;
+    }
+
+    const auto precompiled_path{GetPrecompiledPath()};
+    const bool existed = Common::FS::Exists(precompiled_path);
+
+    Common::FS::IOFile file(precompiled_path, "ab");
+    if (!file.IsOpen()) {
+        LOG_ERROR(Render_OpenGL, "Failed to open precompiled cache in path={}", precompiled_path);
+        return;
+    }
+    if (!existed || file.GetSize() == 0) {
+        const PrecompiledFileHeader file_header{
+            .magic = PrecompiledMagic,
+            .version_hash = GetShaderCacheVersionHash(),
+        };
+        if (file.WriteObject(file_header) != 1) {
+            LOG_ERROR(Render_OpenGL, "Failed to write precompiled cache header in path={}",
+                      precompiled_path);
+            return;
+        }
+    }
+    if (file.WriteBytes(pending_precompiled.data(), pending_precompiled.size()) !=
+        pending_precompiled.size()) {
+        LOG_ERROR(Render_OpenGL, "Failed to append precompiled cache entries in path={}",
+                  precompiled_path);
+    }
+    pending_precompiled.clear();
 }
 
 Common::FS::IOFile ShaderDiskCacheOpenGL::AppendTransferableFile() const {
@@ -414,34 +505,6 @@ Common::FS::IOFile ShaderDiskCacheOpenGL::AppendTransferableFile() const {
     return file;
 }
 
-void ShaderDiskCacheOpenGL::SavePrecompiledHeaderToVirtualPrecompiledCache() {
-    const auto hash{GetShaderCacheVersionHash()};
-    if (!SaveArrayToPrecompiled(hash.data(), hash.size())) {
-        LOG_ERROR(
-            Render_OpenGL,
-            "Failed to write precompiled cache version hash to virtual precompiled cache file");
-    }
-}
-
-void ShaderDiskCacheOpenGL::SaveVirtualPrecompiledFile() {
-    precompiled_cache_virtual_file_offset = 0;
-    const std::vector<u8> uncompressed = precompiled_cache_virtual_file.ReadAllBytes();
-    const std::vector<u8> compressed =
-        Common::Compression::CompressDataZSTDDefault(uncompressed.data(), uncompressed.size());
-
-    const auto precompiled_path{GetPrecompiledPath()};
-    Common::FS::IOFile file(precompiled_path, "wb");
-
-    if (!file.IsOpen()) {
-        LOG_ERROR(Render_OpenGL, "Failed to open precompiled cache in path={}", precompiled_path);
-        return;
-    }
-    if (file.WriteBytes(compressed.data(), compressed.size()) != compressed.size()) {
-        LOG_ERROR(Render_OpenGL, "Failed to write precompiled cache version in path={}",
-                  precompiled_path);
-    }
-}
-
 bool ShaderDiskCacheOpenGL::EnsureDirectories() const {
     const auto CreateDir = [](const std::string& dir) {
         if (!Common::FS::CreateDir(dir)) {
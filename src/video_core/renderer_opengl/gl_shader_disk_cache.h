@@ -17,7 +17,7 @@
 
 #include "common/assert.h"
 #include "common/common_types.h"
-#include "core/file_sys/vfs_vector.h"
+#include "common/mapped_file.h"
 #include "video_core/engines/shader_type.h"
 #include "video_core/shader/registry.h"
 
@@ -75,35 +75,46 @@ public:
     /// Loads transferable cache. If file has a old version or on failure, it deletes the file.
     std::optional<std::vector<ShaderDiskCacheEntry>> LoadTransferable();
 
-    /// Loads current game's precompiled cache. Invalidates on failure.
-    std::vector<ShaderDiskCachePrecompiled> LoadPrecompiled();
+    /// Maps current game's precompiled cache and indexes its entries. Invalidates on failure.
+    void LoadPrecompiled();
+
+    /// Returns true when the precompiled cache has an entry for the shader.
+    bool HasPrecompiled(u64 unique_identifier) const;
+
+    /// Decompresses a precompiled entry. Thread-safe while the cache is not modified.
+    std::optional<ShaderDiskCachePrecompiled> LoadPrecompiledEntry(u64 unique_identifier) const;
 
     /// Removes the transferable (and precompiled) cache file.
     void InvalidateTransferable();
 
-    /// Removes the precompiled cache file and clears virtual precompiled cache file.
+    /// Removes the precompiled cache file and clears its index and pending entries.
     void InvalidatePrecompiled();
 
     /// Saves a raw dump to the transferable file. Checks for collisions.
     void SaveEntry(const ShaderDiskCacheEntry& entry);
 
-    /// Saves a dump entry to the precompiled file. Does not check for collisions.
+    /// Compresses a dump entry to be appended to the precompiled file. Does not check for
+    /// collisions.
     void SavePrecompiled(u64 unique_identifier, GLuint program);
 
-    /// Serializes virtual precompiled shader cache file to real file
-    void SaveVirtualPrecompiledFile();
+    /// Releases the mapped precompiled file and appends the entries saved since the last call.
+    void FlushPrecompiled();
 
 private:
-    /// Loads the transferable cache. Returns empty on failure.
-    std::optional<std::vector<ShaderDiskCachePrecompiled>> LoadPrecompiledFile(
-        Common::FS::IOFile& file);
+    /// Location of a compressed entry in the mapped precompiled file
+    struct PrecompiledLocation {
+        std::size_t offset = 0;
+        u32 compressed_size = 0;
+        u32 binary_size = 0;
+        GLenum binary_format = 0;
+    };
+
+    /// Indexes the entries of the mapped precompiled file. Returns false on failure.
+    bool IndexPrecompiledFile();
 
     /// Opens current game's transferable file and write it's header if it doesn't exist
     Common::FS::IOFile AppendTransferableFile() const;
 
-    /// Save precompiled header to precompiled_cache_in_memory
-    void SavePrecompiledHeaderToVirtualPrecompiledCache();
-
     /// Create shader disk cache directories. Returns true on success.
     bool EnsureDirectories() const;
 
@@ -125,42 +136,12 @@ private:
     /// Get current game's title id
     std::string GetTitleID() const;
 
-    template <typename T>
-    bool SaveArrayToPrecompiled(const T* data, std::size_t length) {
-        const std::size_t write_length = precompiled_cache_virtual_file.WriteArray(
-            data, length, precompiled_cache_virtual_file_offset);
-        precompiled_cache_virtual_file_offset += write_length;
-        return write_length == sizeof(T) * length;
-    }
-
-    template <typename T>
-    bool LoadArrayFromPrecompiled(T* data, std::size_t length) {
-        const std::size_t read_length = precompiled_cache_virtual_file.ReadArray(
-            data, length, precompiled_cache_virtual_file_offset);
-        precompiled_cache_virtual_file_offset += read_length;
-        return read_length == sizeof(T) * length;
-    }
-
-    template <typename T>
-    bool SaveObjectToPrecompiled(const T& object) {
-        return SaveArrayToPrecompiled(&object, 1);
-    }
-
-    bool SaveObjectToPrecompiled(bool object) {
-        const auto value = static_cast<u8>(object);
-        return SaveArrayToPrecompiled(&value, 1);
-    }
-
-    template <typename T>
-    bool LoadObjectFromPrecompiled(T& object) {
-        return LoadArrayFromPrecompiled(&object, 1);
-    }
-
-    // Stores whole precompiled cache which will be read from or saved to the precompiled chache
-    // file
-    FileSys::VectorVfsFile precompiled_cache_virtual_file;
-    // Stores the current offset of the precompiled cache file for IO purposes
-    std::size_t precompiled_cache_virtual_file_offset = 0;
+    // Read-only mapping of the precompiled file, released before the file is modified
+    Common::MappedFile precompiled_file;
+    // Maps shader identifiers to their entries in the mapped precompiled file
+    std::unordered_map<u64, PrecompiledLocation> precompiled_index;
+    // Records saved since the last flush, appended to the precompiled file on flush
+    std::vector<u8> pending_precompiled;
 
     // Stored transferable shaders
     std::unordered_set<u64> stored_transferable;
@@ -259,8 +259,9 @@ constexpr u32 EncodeSwizzle(SwizzleSource x_source, SwizzleSource y_source, Swiz
 } // Anonymous namespace
 
 CachedSurface::CachedSurface(const GPUVAddr gpu_addr, const SurfaceParams& params,
-                             bool is_astc_supported)
-    : VideoCommon::SurfaceBase<View>(gpu_addr, params, is_astc_supported) {
+                             bool is_astc_supported, TextureDecodePasses* decode_passes_)
+    : VideoCommon::SurfaceBase<View>(gpu_addr, params, is_astc_supported),
+      decode_passes{decode_passes_} {
     if (is_converted) {
         internal_format = params.srgb_conversion ? GL_SRGB8_ALPHA8 : GL_RGBA8;
         format = GL_RGBA;
@@ -287,47 +288,166 @@ CachedSurface::CachedSurface(const GPUVAddr gpu_addr, const SurfaceParams& param
 
 CachedSurface::~CachedSurface() = default;
 
-void CachedSurface::DownloadTexture(std::vector<u8>& staging_buffer) {
+void CachedSurface::QueueDownload() {
     MICROPROFILE_SCOPE(OpenGL_Texture_Download);
 
-    if (params.IsBuffer()) {
-        glGetNamedBufferSubData(texture_buffer.handle, 0,
-                                static_cast<GLsizeiptr>(params.GetHostSizeInBytes(false)),
-                                staging_buffer.data());
-        return;
+    if (download_buffer.handle == 0) {
+        download_buffer.Create();
+        glNamedBufferStorage(download_buffer.handle, static_cast<GLsizeiptr>(host_memory_size),
+                             nullptr, GL_CLIENT_STORAGE_BIT);
     }
 
-    SCOPE_EXIT({ glPixelStorei(GL_PACK_ROW_LENGTH, 0); });
-
-    for (u32 level = 0; level < params.emulated_levels; ++level) {
-        glPixelStorei(GL_PACK_ALIGNMENT, std::min(8U, params.GetRowAlignment(level, is_converted)));
-        glPixelStorei(GL_PACK_ROW_LENGTH, static_cast<GLint>(params.GetMipWidth(level)));
-        const std::size_t mip_offset = params.GetHostMipmapLevelOffset(level, is_converted);
+    if (params.IsBuffer()) {
+        glCopyNamedBufferSubData(texture_buffer.handle, download_buffer.handle, 0, 0,
+                                 static_cast<GLsizeiptr>(params.GetHostSizeInBytes(false)));
+    } else {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, download_buffer.handle);
+        SCOPE_EXIT({
+            glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        });
 
-        u8* const mip_data = staging_buffer.data() + mip_offset;
-        const GLsizei size = static_cast<GLsizei>(params.GetHostMipmapSize(level));
-        if (is_compressed) {
-            glGetCompressedTextureImage(texture.handle, level, size, mip_data);
-        } else {
-            glGetTextureImage(texture.handle, level, format, type, size, mip_data);
+        for (u32 level = 0; level < params.emulated_levels; ++level) {
+            glPixelStorei(GL_PACK_ALIGNMENT,
+                          std::min(8U, params.GetRowAlignment(level, is_converted)));
+            glPixelStorei(GL_PACK_ROW_LENGTH, static_cast<GLint>(params.GetMipWidth(level)));
+            const std::size_t mip_offset = params.GetHostMipmapLevelOffset(level, is_converted);
+
+            // Offsets are relative to the bound pixel pack buffer
+            void* const mip_data = reinterpret_cast<void*>(mip_offset);
+            const GLsizei size = static_cast<GLsizei>(params.GetHostMipmapSize(level));
+            if (is_compressed) {
+                glGetCompressedTextureImage(texture.handle, level, size, mip_data);
+            } else {
+                glGetTextureImage(texture.handle, level, format, type, size, mip_data);
+            }
         }
     }
+
+    download_sync.Release();
+    download_sync.Create();
+}
+
+void CachedSurface::FinishDownload(std::vector<u8>& staging_buffer) {
+    MICROPROFILE_SCOPE(OpenGL_Texture_Download);
+    ASSERT(download_sync.handle != 0);
+
+    glClientWaitSync(download_sync.handle, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    download_sync.Release();
+
+    glGetNamedBufferSubData(download_buffer.handle, 0, static_cast<GLsizeiptr>(host_memory_size),
+                            staging_buffer.data());
+
+    // Don't keep host visible memory around for surfaces that are rarely flushed
+    download_buffer.Release();
 }
 
 void CachedSurface::UploadTexture(const std::vector<u8>& staging_buffer) {
     MICROPROFILE_SCOPE(OpenGL_Texture_Upload);
     SCOPE_EXIT({ glPixelStorei(GL_UNPACK_ROW_LENGTH, 0); });
     for (u32 level = 0; level < params.emulated_levels; ++level) {
-        UploadTextureMipmap(level, staging_buffer);
+        const std::size_t mip_offset = params.GetHostMipmapLevelOffset(level, is_converted);
+        UploadTextureMipmap(level, staging_buffer.data() + mip_offset);
+    }
+}
+
+bool CachedSurface::UploadGuestTexture(const std::vector<u8>& guest_buffer) {
+    if (!CanDecodeOnGPU()) {
+        return false;
+    }
+    MICROPROFILE_SCOPE(OpenGL_Texture_Upload);
+
+    const GLuint guest = decode_passes->ScratchBuffer(0, guest_buffer.size());
+    glNamedBufferSubData(guest, 0, static_cast<GLsizeiptr>(guest_buffer.size()),
+                         guest_buffer.data());
+
+    const GLuint unswizzled = decode_passes->ScratchBuffer(1, params.GetHostSizeInBytes(false));
+    const u32 bytes_per_block = params.GetBytesPerPixel();
+    const u32 tile_width = params.GetDefaultBlockWidth();
+    const u32 tile_height = params.GetDefaultBlockHeight();
+    for (u32 level = 0; level < params.num_levels; ++level) {
+        const u32 width = (params.GetMipWidth(level) + tile_width - 1) / tile_width;
+        const u32 height = (params.GetMipHeight(level) + tile_height - 1) / tile_height;
+        const u32 block_height = params.GetMipBlockHeight(level);
+        const u32 block_depth = params.GetMipBlockDepth(level);
+        std::size_t guest_offset = mipmap_offsets[level];
+        std::size_t host_offset = params.GetHostMipmapLevelOffset(level, false);
+        if (!params.is_layered) {
+            decode_passes->block_linear_unswizzle.Unswizzle(
+                guest, guest_offset, unswizzled, host_offset, bytes_per_block, width, height,
+                params.GetMipDepth(level), block_height, block_depth, params.tile_width_spacing);
+            continue;
+        }
+        for (u32 layer = 0; layer < params.depth; ++layer) {
+            decode_passes->block_linear_unswizzle.Unswizzle(
+                guest, guest_offset, unswizzled, host_offset, bytes_per_block, width, height, 1,
+                block_height, block_depth, params.tile_width_spacing);
+            guest_offset += layer_size;
+            host_offset += params.GetHostLayerSize(level);
+        }
+    }
+
+    if (params.pixel_format == PixelFormat::S8_UINT_D24_UNORM) {
+        for (u32 level = 0; level < params.num_levels; ++level) {
+            const u32 num_texels = params.GetMipWidth(level) * params.GetMipHeight(level) *
+                                   params.GetMipDepth(level);
+            decode_passes->s8d24_convert.Convert(
+                unswizzled, params.GetHostMipmapLevelOffset(level, false), num_texels);
+        }
+    }
+
+    GLuint upload_buffer = unswizzled;
+    if (is_converted) {
+        upload_buffer = decode_passes->ScratchBuffer(2, host_memory_size);
+        const auto [block_width, block_height] = GetASTCBlockSize(params.pixel_format);
+        for (u32 level = 0; level < params.num_levels; ++level) {
+            decode_passes->astc_decoder.Decode(
+                unswizzled, params.GetHostMipmapLevelOffset(level, false), upload_buffer,
+                params.GetHostMipmapLevelOffset(level, true), params.GetMipWidth(level),
+                params.GetMipHeight(level), params.GetMipDepth(level), block_width, block_height);
+        }
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, upload_buffer);
+    SCOPE_EXIT({
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    });
+    for (u32 level = 0; level < params.emulated_levels; ++level) {
+        // Offsets are relative to the bound pixel unpack buffer
+        const std::size_t mip_offset = params.GetHostMipmapLevelOffset(level, is_converted);
+        UploadTextureMipmap(level, reinterpret_cast<const u8*>(mip_offset));
     }
+    return true;
 }
 
-void CachedSurface::UploadTextureMipmap(u32 level, const std::vector<u8>& staging_buffer) {
+bool CachedSurface::CanDecodeOnGPU() const {
+    if (decode_passes == nullptr) {
+        return false;
+    }
+    if (!params.is_tiled || params.IsBuffer() || params.block_width != 0) {
+        return false;
+    }
+    // Compute passes work on 32-bit words, formats with 3 byte multiples and narrow rows of 8
+    // and 16-bit texels are left to the CPU
+    const u32 bytes_per_block = params.GetBytesPerPixel();
+    if ((bytes_per_block & (bytes_per_block - 1)) != 0) {
+        return false;
+    }
+    const u32 tile_width = params.GetDefaultBlockWidth();
+    for (u32 level = 0; level < params.num_levels; ++level) {
+        const u32 width = (params.GetMipWidth(level) + tile_width - 1) / tile_width;
+        if (width * bytes_per_block % 4 != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CachedSurface::UploadTextureMipmap(u32 level, const u8* buffer) {
     glPixelStorei(GL_UNPACK_ALIGNMENT, std::min(8U, params.GetRowAlignment(level, is_converted)));
     glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(params.GetMipWidth(level)));
 
-    const std::size_t mip_offset = params.GetHostMipmapLevelOffset(level, is_converted);
-    const u8* buffer{staging_buffer.data() + mip_offset};
     if (is_compressed) {
         const auto image_size{static_cast<GLsizei>(params.GetHostMipmapSize(level))};
         switch (params.target) {
@@ -540,12 +660,18 @@ TextureCacheOpenGL::TextureCacheOpenGL(VideoCore::RasterizerInterface& rasterize
                                                                                  state_tracker_} {
     src_framebuffer.Create();
     dst_framebuffer.Create();
+
+    // Without compute passes guest textures are unswizzled and decoded on the CPU
+    if (device.UseAcceleratedTextureDecoding()) {
+        decode_passes.emplace();
+    }
 }
 
 TextureCacheOpenGL::~TextureCacheOpenGL() = default;
 
 Surface TextureCacheOpenGL::CreateSurface(GPUVAddr gpu_addr, const SurfaceParams& params) {
-    return std::make_shared<CachedSurface>(gpu_addr, params, is_astc_supported);
+    TextureDecodePasses* const passes = decode_passes ? &*decode_passes : nullptr;
+    return std::make_shared<CachedSurface>(gpu_addr, params, is_astc_supported, passes);
 }
 
 void TextureCacheOpenGL::ImageCopy(Surface& src_surface, Surface& dst_surface,
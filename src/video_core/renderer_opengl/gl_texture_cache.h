@@ -7,6 +7,7 @@
 #include <array>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -15,6 +16,7 @@
 
 #include "common/common_types.h"
 #include "video_core/engines/shader_bytecode.h"
+#include "video_core/renderer_opengl/gl_compute_pass.h"
 #include "video_core/renderer_opengl/gl_device.h"
 #include "video_core/renderer_opengl/gl_resource_manager.h"
 #include "video_core/texture_cache/texture_cache.h"
@@ -37,11 +39,14 @@ class CachedSurface final : public VideoCommon::SurfaceBase<View> {
     friend CachedSurfaceView;
 
 public:
-    explicit CachedSurface(GPUVAddr gpu_addr, const SurfaceParams& params, bool is_astc_supported);
+    explicit CachedSurface(GPUVAddr gpu_addr, const SurfaceParams& params, bool is_astc_supported,
+                           TextureDecodePasses* decode_passes);
     ~CachedSurface();
 
     void UploadTexture(const std::vector<u8>& staging_buffer) override;
-    void DownloadTexture(std::vector<u8>& staging_buffer) override;
+    bool UploadGuestTexture(const std::vector<u8>& guest_buffer) override;
+    void QueueDownload() override;
+    void FinishDownload(std::vector<u8>& staging_buffer) override;
 
     GLenum GetTarget() const {
         return target;
@@ -62,7 +67,13 @@ protected:
     View CreateViewInner(const ViewParams& view_key, bool is_proxy);
 
 private:
-    void UploadTextureMipmap(u32 level, const std::vector<u8>& staging_buffer);
+    /// Uploads a mipmap level from host memory or from the bound pixel unpack buffer
+    void UploadTextureMipmap(u32 level, const u8* buffer);
+
+    /// Returns true when the guest data of the surface can be decoded with compute passes
+    bool CanDecodeOnGPU() const;
+
+    TextureDecodePasses* decode_passes; ///< Null when textures are decoded on the CPU
 
     GLenum internal_format{};
     GLenum format{};
@@ -73,6 +84,9 @@ private:
 
     OGLTexture texture;
     OGLBuffer texture_buffer;
+
+    OGLBuffer download_buffer;
+    OGLSync download_sync;
 };
 
 class CachedSurfaceView final : public VideoCommon::ViewBase {
@@ -150,6 +164,7 @@ private:
     GLuint FetchPBO(std::size_t buffer_size);
 
     StateTracker& state_tracker;
+    std::optional<TextureDecodePasses> decode_passes;
 
     OGLFramebuffer src_framebuffer;
     OGLFramebuffer dst_framebuffer;
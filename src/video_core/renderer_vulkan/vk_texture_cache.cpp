@@ -109,6 +109,19 @@ vk::Buffer CreateBuffer(const VKDevice& device, const SurfaceParams& params,
     });
 }
 
+vk::Buffer CreateDownloadBuffer(const VKDevice& device, std::size_t host_memory_size) {
+    return device.GetLogical().CreateBuffer({
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .size = static_cast<VkDeviceSize>(host_memory_size),
+        .usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = nullptr,
+    });
+}
+
 VkBufferViewCreateInfo GenerateBufferViewCreateInfo(const VKDevice& device,
                                                     const SurfaceParams& params, VkBuffer buffer,
                                                     std::size_t host_memory_size) {
@@ -231,31 +244,47 @@ void CachedSurface::UploadTexture(const std::vector<u8>& staging_buffer) {
     }
 }
 
-void CachedSurface::DownloadTexture(std::vector<u8>& staging_buffer) {
+void CachedSurface::QueueDownload() {
     UNIMPLEMENTED_IF(params.IsBuffer());
 
     if (params.pixel_format == VideoCore::Surface::PixelFormat::A1B5G5R5_UNORM) {
         LOG_WARNING(Render_Vulkan, "A1B5G5R5 flushing is stubbed");
     }
 
+    if (!download_buffer) {
+        download_buffer = CreateDownloadBuffer(device, host_memory_size);
+        download_commit = memory_manager.Commit(download_buffer, true);
+    }
+
     // We can't copy images to buffers inside a renderpass
     scheduler.RequestOutsideRenderPassOperationContext();
 
     FullTransition(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT,
                    VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
 
-    const auto& buffer = staging_pool.GetUnusedBuffer(host_memory_size, true);
     // TODO(Rodrigo): Do this in a single copy
     for (u32 level = 0; level < params.num_levels; ++level) {
-        scheduler.Record([image = *image->GetHandle(), buffer = *buffer.handle,
+        scheduler.Record([image = *image->GetHandle(), buffer = *download_buffer,
                           copy = GetBufferImageCopy(level)](vk::CommandBuffer cmdbuf) {
             cmdbuf.CopyImageToBuffer(image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer, copy);
         });
     }
-    scheduler.Finish();
+    download_tick = scheduler.CurrentTick();
+}
+
+void CachedSurface::FinishDownload(std::vector<u8>& staging_buffer) {
+    ASSERT(download_buffer);
+
+    if (download_tick == scheduler.CurrentTick()) {
+        scheduler.Flush();
+    }
+    scheduler.Wait(download_tick);
+
+    std::memcpy(staging_buffer.data(), download_commit->Map(host_memory_size), host_memory_size);
 
-    // TODO(Rodrigo): Use an intern buffer for staging buffers and avoid this unnecessary memcpy.
-    std::memcpy(staging_buffer.data(), buffer.commit->Map(host_memory_size), host_memory_size);
+    // Don't keep host visible memory around for surfaces that are rarely flushed
+    download_buffer.reset();
+    download_commit.reset();
 }
 
 void CachedSurface::DecorateSurfaceName() {
@@ -46,7 +46,8 @@ public:
     ~CachedSurface();
 
     void UploadTexture(const std::vector<u8>& staging_buffer) override;
-    void DownloadTexture(std::vector<u8>& staging_buffer) override;
+    void QueueDownload() override;
+    void FinishDownload(std::vector<u8>& staging_buffer) override;
 
     void FullTransition(VkPipelineStageFlags new_stage_mask, VkAccessFlags new_access,
                         VkImageLayout new_layout) {
@@ -105,6 +106,10 @@ private:
     vk::BufferView buffer_view;
     VKMemoryCommit commit;
 
+    vk::Buffer download_buffer;
+    VKMemoryCommit download_commit;
+    u64 download_tick = 0;
+
     VkFormat format = VK_FORMAT_UNDEFINED;
 };
 
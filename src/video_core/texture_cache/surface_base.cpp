@@ -192,16 +192,18 @@ void SurfaceBaseImpl::SwizzleFunc(MortonSwizzleMode mode, u8* memory, const Surf
     }
 }
 
-void SurfaceBaseImpl::LoadBuffer(Tegra::MemoryManager& memory_manager,
-                                 StagingCache& staging_cache) {
-    MICROPROFILE_SCOPE(GPU_Load_Texture);
-    auto& staging_buffer = staging_cache.GetBuffer(0);
-    u8* host_ptr;
+void SurfaceBaseImpl::ReadGuestBuffer(Tegra::MemoryManager& memory_manager,
+                                      StagingCache& staging_cache) {
     // Use an extra temporal buffer
     auto& tmp_buffer = staging_cache.GetBuffer(1);
     tmp_buffer.resize(guest_memory_size);
-    host_ptr = tmp_buffer.data();
-    memory_manager.ReadBlockUnsafe(gpu_addr, host_ptr, guest_memory_size);
+    memory_manager.ReadBlockUnsafe(gpu_addr, tmp_buffer.data(), guest_memory_size);
+}
+
+void SurfaceBaseImpl::DecodeGuestBuffer(StagingCache& staging_cache) {
+    MICROPROFILE_SCOPE(GPU_Load_Texture);
+    auto& staging_buffer = staging_cache.GetBuffer(0);
+    u8* const host_ptr = staging_cache.GetBuffer(1).data();
 
     if (params.is_tiled) {
         ASSERT_MSG(params.block_width == 0, "Block width is defined as {} on texture target {}",
@@ -60,7 +60,12 @@ private:
 
 class SurfaceBaseImpl {
 public:
-    void LoadBuffer(Tegra::MemoryManager& memory_manager, StagingCache& staging_cache);
+    /// Reads the guest memory of the surface into the second staging buffer
+    void ReadGuestBuffer(Tegra::MemoryManager& memory_manager, StagingCache& staging_cache);
+
+    /// Unswizzles and converts the guest buffer read by ReadGuestBuffer into the first staging
+    /// buffer, which has to be sized to the host size of the surface
+    void DecodeGuestBuffer(StagingCache& staging_cache);
 
     void FlushBuffer(Tegra::MemoryManager& memory_manager, StagingCache& staging_cache);
 
@@ -180,7 +185,18 @@ class SurfaceBase : public SurfaceBaseImpl {
 public:
     virtual void UploadTexture(const std::vector<u8>& staging_buffer) = 0;
 
-    virtual void DownloadTexture(std::vector<u8>& staging_buffer) = 0;
+    /// Uploads the guest buffer decoding it on the host GPU
+    /// @returns false when the surface has to be decoded on the CPU instead
+    virtual bool UploadGuestTexture([[maybe_unused]] const std::vector<u8>& guest_buffer) {
+        return false;
+    }
+
+    /// Queues a copy of the surface contents to host visible memory without waiting for the GPU
+    virtual void QueueDownload() = 0;
+
+    /// Waits for the last queued download, copies its contents to the staging buffer and releases
+    /// the host visible memory backing it
+    virtual void FinishDownload(std::vector<u8>& staging_buffer) = 0;
 
     void MarkAsModified(bool is_modified_, u64 tick) {
         is_modified = is_modified_ || is_target;
@@ -245,6 +261,20 @@ public:
         return modification_tick;
     }
 
+    void MarkAsDownloadPending(bool is_download_pending_) {
+        is_download_pending = is_download_pending_;
+        download_tick = modification_tick;
+    }
+
+    bool IsDownloadPending() const {
+        return is_download_pending;
+    }
+
+    /// Returns true when the queued download holds the latest contents of the surface
+    bool IsDownloadCurrent() const {
+        return is_download_pending && download_tick == modification_tick;
+    }
+
     TView EmplaceOverview(const SurfaceParams& overview_params) {
         const u32 num_layers{(params.is_layered && !overview_params.is_layered) ? 1 : params.depth};
         return GetView(ViewParams(overview_params.target, 0, num_layers, 0, params.num_levels));
@@ -326,8 +356,10 @@ private:
     bool is_picked{};
     bool is_memory_marked{};
     bool is_sync_pending{};
+    bool is_download_pending{};
     u32 index{NO_RT};
     u64 modification_tick{};
+    u64 download_tick{};
 };
 
 } // namespace VideoCommon
@@ -21,6 +21,7 @@
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/math_util.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/memory.h"
 #include "core/settings.h"
@@ -103,7 +104,7 @@ public:
     }
 
     void FlushRegion(VAddr addr, std::size_t size) {
-        std::lock_guard lock{mutex};
+        std::unique_lock lock{mutex};
 
         auto surfaces = GetSurfacesInRegion(addr, size);
         if (surfaces.empty()) {
@@ -112,11 +113,15 @@ public:
         std::sort(surfaces.begin(), surfaces.end(), [](const TSurface& a, const TSurface& b) {
             return a->GetModificationTick() < b->GetModificationTick();
         });
+        // Queue every copy before waiting on any of them, downloads committed by a fence are
+        // reused when the surface hasn't been modified since
         for (const auto& surface : surfaces) {
-            mutex.unlock();
-            FlushSurface(surface);
-            mutex.lock();
+            if (surface->IsModified() && !surface->IsDownloadCurrent()) {
+                QueueDownload(surface);
+            }
         }
+        lock.unlock();
+        FlushSurfaces(surfaces);
     }
 
     bool MustFlushRegion(VAddr addr, std::size_t size) {
@@ -324,6 +329,14 @@ public:
     }
 
     void CommitAsyncFlushes() {
+        if (uncommitted_flushes) {
+            // Start the copies now, they will be done on the host GPU when the fence is signalled
+            for (const TSurface& surface : *uncommitted_flushes) {
+                if (surface->IsModified() && !surface->IsDownloadCurrent()) {
+                    QueueDownload(surface);
+                }
+            }
+        }
         committed_flushes.push_back(uncommitted_flushes);
         uncommitted_flushes.reset();
     }
@@ -345,9 +358,7 @@ public:
             committed_flushes.pop_front();
             return;
         }
-        for (TSurface& surface : *flush_list) {
-            FlushSurface(surface);
-        }
+        FlushSurfaces(*flush_list);
         committed_flushes.pop_front();
     }
 
@@ -363,6 +374,9 @@ protected:
 
         SetEmptyDepthBuffer();
         staging_cache.SetSize(2);
+        for (StagingCache& cache : download_caches) {
+            cache.SetSize(2);
+        }
 
         const auto make_siblings = [this](PixelFormat a, PixelFormat b) {
             siblings_table[static_cast<std::size_t>(a)] = b;
@@ -1104,20 +1118,71 @@ private:
     }
 
     void LoadSurface(const TSurface& surface) {
-        staging_cache.GetBuffer(0).resize(surface->GetHostSizeInBytes());
-        surface->LoadBuffer(gpu_memory, staging_cache);
-        surface->UploadTexture(staging_cache.GetBuffer(0));
+        surface->ReadGuestBuffer(gpu_memory, staging_cache);
+        if (!surface->UploadGuestTexture(staging_cache.GetBuffer(1))) {
+            staging_cache.GetBuffer(0).resize(surface->GetHostSizeInBytes());
+            surface->DecodeGuestBuffer(staging_cache);
+            surface->UploadTexture(staging_cache.GetBuffer(0));
+        }
         surface->MarkAsModified(false, Tick());
     }
 
     void FlushSurface(const TSurface& surface) {
-        if (!surface->IsModified()) {
-            return;
+        FlushSurfaces(std::array{surface});
+    }
+
+    void QueueDownload(const TSurface& surface) {
+        surface->QueueDownload();
+        surface->MarkAsDownloadPending(true);
+    }
+
+    /**
+     * Waits for the downloads of the given modified surfaces and writes them back to guest memory.
+     * Swizzling is done by the flush workers, surfaces overlapping a previous one in the range are
+     * written after it. Only the downloads of these surfaces are waited for.
+     */
+    template <typename Range>
+    void FlushSurfaces(const Range& surfaces) {
+        VectorSurface in_flight;
+        std::size_t cache_index = 0;
+        for (const TSurface& surface : surfaces) {
+            if (!surface->IsModified()) {
+                continue;
+            }
+            if (!surface->IsDownloadPending()) {
+                QueueDownload(surface);
+            }
+            const bool is_current = surface->IsDownloadCurrent();
+            if (cache_index == download_caches.size()) {
+                // Every staging cache is in use, wait for the workers before recycling them
+                flush_workers.WaitForRequests();
+                in_flight.clear();
+                cache_index = 0;
+            }
+            StagingCache& cache = download_caches[cache_index++];
+            cache.GetBuffer(0).resize(surface->GetHostSizeInBytes());
+            surface->FinishDownload(cache.GetBuffer(0));
+            surface->MarkAsDownloadPending(false);
+
+            const VAddr start = surface->GetCpuAddr();
+            const VAddr end = surface->GetCpuAddrEnd();
+            const bool overlaps = std::any_of(
+                in_flight.begin(), in_flight.end(),
+                [start, end](const TSurface& other) { return other->Overlaps(start, end); });
+            if (overlaps) {
+                flush_workers.WaitForRequests();
+                in_flight.clear();
+            }
+            in_flight.push_back(surface);
+            flush_workers.QueueWork(
+                [this, surface, &cache] { surface->FlushBuffer(gpu_memory, cache); });
+
+            // A download queued before the last modification only holds older contents
+            if (is_current) {
+                surface->MarkAsModified(false, Tick());
+            }
         }
-        staging_cache.GetBuffer(0).resize(surface->GetHostSizeInBytes());
-        surface->DownloadTexture(staging_cache.GetBuffer(0));
-        surface->FlushBuffer(gpu_memory, staging_cache);
-        surface->MarkAsModified(false, Tick());
+        flush_workers.WaitForRequests();
     }
 
     void RegisterInnerCache(TSurface& surface) {
@@ -1270,6 +1335,9 @@ private:
     static constexpr u64 registry_page_size{1 << registry_page_bits};
     std::unordered_map<VAddr, std::vector<TSurface>> registry;
 
+    static constexpr std::size_t NUM_FLUSH_WORKERS = 2;
+    static constexpr std::size_t NUM_DOWNLOAD_CACHES = NUM_FLUSH_WORKERS * 2;
+
     static constexpr u32 DEPTH_RT = 8;
     static constexpr u32 NO_RT = 0xFFFFFFFF;
 
@@ -1298,6 +1366,8 @@ private:
     std::list<std::shared_ptr<std::list<TSurface>>> committed_flushes;
 
     StagingCache staging_cache;
+    std::array<StagingCache, NUM_DOWNLOAD_CACHES> download_caches;
+    Common::ThreadWorker flush_workers{NUM_FLUSH_WORKERS, "yuzu:TextureFlush"};
     std::recursive_mutex mutex;
 };
 
@@ -581,6 +581,8 @@ void Config::ReadDebuggingValues() {
     Settings::values.quest_flag = ReadSetting(QStringLiteral("quest_flag"), false).toBool();
     Settings::values.disable_macro_jit =
         ReadSetting(QStringLiteral("disable_macro_jit"), false).toBool();
+    Settings::values.capture_gpu_trace =
+        ReadSetting(QStringLiteral("capture_gpu_trace"), false).toBool();
 
     qt_config->endGroup();
 }
@@ -726,6 +728,10 @@ void Config::ReadRendererValues() {
                       QStringLiteral("use_asynchronous_shaders"), false);
     ReadSettingGlobal(Settings::values.use_fast_gpu_time, QStringLiteral("use_fast_gpu_time"),
                       true);
+    ReadSettingGlobal(Settings::values.use_low_latency_presentation,
+                      QStringLiteral("use_low_latency_presentation"), false);
+    ReadSettingGlobal(Settings::values.use_accelerated_texture_decoding,
+                      QStringLiteral("use_accelerated_texture_decoding"), true);
     ReadSettingGlobal(Settings::values.bg_red, QStringLiteral("bg_red"), 0.0);
     ReadSettingGlobal(Settings::values.bg_green, QStringLiteral("bg_green"), 0.0);
     ReadSettingGlobal(Settings::values.bg_blue, QStringLiteral("bg_blue"), 0.0);
@@ -1156,6 +1162,7 @@ void Config::SaveDebuggingValues() {
     WriteSetting(QStringLiteral("dump_nso"), Settings::values.dump_nso, false);
     WriteSetting(QStringLiteral("quest_flag"), Settings::values.quest_flag, false);
     WriteSetting(QStringLiteral("disable_macro_jit"), Settings::values.disable_macro_jit, false);
+    WriteSetting(QStringLiteral("capture_gpu_trace"), Settings::values.capture_gpu_trace, false);
 
     qt_config->endGroup();
 }
@@ -1276,6 +1283,10 @@ void Config::SaveRendererValues() {
                        Settings::values.use_asynchronous_shaders, false);
     WriteSettingGlobal(QStringLiteral("use_fast_gpu_time"), Settings::values.use_fast_gpu_time,
                        true);
+    WriteSettingGlobal(QStringLiteral("use_low_latency_presentation"),
+                       Settings::values.use_low_latency_presentation, false);
+    WriteSettingGlobal(QStringLiteral("use_accelerated_texture_decoding"),
+                       Settings::values.use_accelerated_texture_decoding, true);
     // Cast to double because Qt's written float values are not human-readable
     WriteSettingGlobal(QStringLiteral("bg_red"), Settings::values.bg_red, 0.0);
     WriteSettingGlobal(QStringLiteral("bg_green"), Settings::values.bg_green, 0.0);
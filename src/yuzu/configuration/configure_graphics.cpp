@@ -75,6 +75,8 @@ void ConfigureGraphics::SetConfiguration() {
     ui->use_asynchronous_gpu_emulation->setChecked(
         Settings::values.use_asynchronous_gpu_emulation.GetValue());
     ui->use_nvdec_emulation->setChecked(Settings::values.use_nvdec_emulation.GetValue());
+    ui->use_low_latency_presentation->setChecked(
+        Settings::values.use_low_latency_presentation.GetValue());
 
     if (Settings::configuring_global) {
         ui->api->setCurrentIndex(static_cast<int>(Settings::values.renderer_backend.GetValue()));
@@ -121,6 +123,10 @@ void ConfigureGraphics::ApplyConfiguration() {
         if (Settings::values.use_nvdec_emulation.UsingGlobal()) {
             Settings::values.use_nvdec_emulation.SetValue(ui->use_nvdec_emulation->isChecked());
         }
+        if (Settings::values.use_low_latency_presentation.UsingGlobal()) {
+            Settings::values.use_low_latency_presentation.SetValue(
+                ui->use_low_latency_presentation->isChecked());
+        }
         if (Settings::values.bg_red.UsingGlobal()) {
             Settings::values.bg_red.SetValue(static_cast<float>(bg_color.redF()));
             Settings::values.bg_green.SetValue(static_cast<float>(bg_color.greenF()));
@@ -151,6 +157,9 @@ void ConfigureGraphics::ApplyConfiguration() {
                                                  use_asynchronous_gpu_emulation);
         ConfigurationShared::ApplyPerGameSetting(&Settings::values.use_nvdec_emulation,
                                                  ui->use_nvdec_emulation, use_nvdec_emulation);
+        ConfigurationShared::ApplyPerGameSetting(&Settings::values.use_low_latency_presentation,
+                                                 ui->use_low_latency_presentation,
+                                                 use_low_latency_presentation);
 
         if (ui->bg_combobox->currentIndex() == ConfigurationShared::USE_GLOBAL_INDEX) {
             Settings::values.bg_red.SetGlobal(true);
@@ -210,6 +219,9 @@ void ConfigureGraphics::UpdateDeviceComboBox() {
         ui->device->setCurrentIndex(vulkan_device);
         enabled = !vulkan_devices.empty();
         break;
+    case Settings::RendererBackend::Null:
+        enabled = false;
+        break;
     }
     // If in per-game config and use global is selected, don't enable.
     enabled &= !(!Settings::configuring_global &&
@@ -249,6 +261,8 @@ void ConfigureGraphics::SetupPerGameUI() {
             Settings::values.use_asynchronous_gpu_emulation.UsingGlobal());
         ui->use_nvdec_emulation->setEnabled(Settings::values.use_nvdec_emulation.UsingGlobal());
         ui->use_disk_shader_cache->setEnabled(Settings::values.use_disk_shader_cache.UsingGlobal());
+        ui->use_low_latency_presentation->setEnabled(
+            Settings::values.use_low_latency_presentation.UsingGlobal());
         ui->bg_button->setEnabled(Settings::values.bg_red.UsingGlobal());
 
         return;
@@ -266,6 +280,9 @@ void ConfigureGraphics::SetupPerGameUI() {
     ConfigurationShared::SetColoredTristate(ui->use_asynchronous_gpu_emulation,
                                             Settings::values.use_asynchronous_gpu_emulation,
                                             use_asynchronous_gpu_emulation);
+    ConfigurationShared::SetColoredTristate(ui->use_low_latency_presentation,
+                                            Settings::values.use_low_latency_presentation,
+                                            use_low_latency_presentation);
 
     ConfigurationShared::SetColoredComboBox(ui->aspect_ratio_combobox, ui->ar_label,
                                             Settings::values.aspect_ratio.GetValue(true));
@@ -49,6 +49,7 @@ private:
     ConfigurationShared::CheckState use_nvdec_emulation;
     ConfigurationShared::CheckState use_disk_shader_cache;
     ConfigurationShared::CheckState use_asynchronous_gpu_emulation;
+    ConfigurationShared::CheckState use_low_latency_presentation;
 
     std::vector<QString> vulkan_devices;
     u32 vulkan_device{};
@@ -530,9 +530,13 @@ void GMainWindow::InitializeWidgets() {
     emu_frametime_label->setToolTip(
         tr("时间采取模拟开关框架，不计算框架限制或垂直刷新同步 "
            "对于全速仿真，这应该是最多 16.67 ms."));
+    frame_pacing_label = new QLabel();
+    frame_pacing_label->setToolTip(
+        tr("呈现帧间隔的标准差和最长间隔，每帧等待 GPU 完成的时间，"
+           "以及未经呈现就被丢弃的游戏帧数."));
 
-    for (auto& label :
-         {shader_building_label, emu_speed_label, game_fps_label, emu_frametime_label}) {
+    for (auto& label : {shader_building_label, emu_speed_label, game_fps_label,
+                        emu_frametime_label, frame_pacing_label}) {
         label->setVisible(false);
         label->setFrameStyle(QFrame::NoFrame);
         label->setContentsMargins(4, 0, 4, 0);
@@ -1213,6 +1217,7 @@ void GMainWindow::ShutdownGame() {
     emu_speed_label->setVisible(false);
     game_fps_label->setVisible(false);
     emu_frametime_label->setVisible(false);
+    frame_pacing_label->setVisible(false);
     async_status_button->setEnabled(true);
     multicore_status_button->setEnabled(true);
 #ifdef HAS_VULKAN
@@ -2448,10 +2453,16 @@ void GMainWindow::UpdateStatusBar() {
     }
     game_fps_label->setText(tr("帧率: %1 FPS").arg(results.game_fps, 0, 'f', 0));
     emu_frametime_label->setText(tr("帧间: %1 ms").arg(results.frametime * 1000.0, 0, 'f', 2));
+    frame_pacing_label->setText(tr("抖动: %1 ms / 最长: %2 ms / GPU 等待: %3 ms / 丢帧: %4")
+                                    .arg(results.frame_pacing_jitter * 1000.0, 0, 'f', 2)
+                                    .arg(results.max_frame_interval * 1000.0, 0, 'f', 2)
+                                    .arg(results.gpu_wait_time * 1000.0, 0, 'f', 2)
+                                    .arg(results.dropped_frames));
 
     emu_speed_label->setVisible(!Settings::values.use_multi_core.GetValue());
     game_fps_label->setVisible(true);
     emu_frametime_label->setVisible(true);
+    frame_pacing_label->setVisible(true);
 }
 
 void GMainWindow::UpdateStatusButtons() {
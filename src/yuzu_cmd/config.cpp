@@ -406,6 +406,10 @@ void Config::ReadValues() {
         sdl2_config->GetBoolean("Renderer", "use_asynchronous_shaders", false));
     Settings::values.use_fast_gpu_time.SetValue(
         sdl2_config->GetBoolean("Renderer", "use_fast_gpu_time", true));
+    Settings::values.use_low_latency_presentation.SetValue(
+        sdl2_config->GetBoolean("Renderer", "use_low_latency_presentation", false));
+    Settings::values.use_accelerated_texture_decoding.SetValue(
+        sdl2_config->GetBoolean("Renderer", "use_accelerated_texture_decoding", true));
 
     Settings::values.bg_red.SetValue(
         static_cast<float>(sdl2_config->GetReal("Renderer", "bg_red", 0.0)));
@@ -440,6 +444,8 @@ void Config::ReadValues() {
     Settings::values.quest_flag = sdl2_config->GetBoolean("Debugging", "quest_flag", false);
     Settings::values.disable_macro_jit =
         sdl2_config->GetBoolean("Debugging", "disable_macro_jit", false);
+    Settings::values.capture_gpu_trace =
+        sdl2_config->GetBoolean("Debugging", "capture_gpu_trace", false);
 
     const auto title_list = sdl2_config->Get("AddOns", "title_ids", "");
     std::stringstream ss(title_list);
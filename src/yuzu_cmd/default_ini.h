@@ -132,7 +132,7 @@ cpuopt_reduce_misalign_checks =
 
 [Renderer]
 # Which backend API to use.
-# 0 (default): OpenGL, 1: Vulkan
+# 0 (default): OpenGL, 1: Vulkan, 2: Null
 backend =
 
 # Enable graphics API debugging mode.
@@ -190,6 +190,14 @@ gpu_accuracy =
 # 0 : Off (slow), 1 (default): On (fast)
 use_asynchronous_gpu_emulation =
 
+# Presents only the most recent frame queued by the game, dropping older ones to reduce latency
+# 0 (default): Off, 1: On
+use_low_latency_presentation =
+
+# Whether OpenGL unswizzles and decodes guest textures with compute shaders instead of on the CPU
+# 0: Off, 1 (default): On
+use_accelerated_texture_decoding =
+
 # Forces VSync on the display thread. Usually doesn't impact performance, but on some drivers it can
 # so only turn this off if you notice a speed difference.
 # 0: Off, 1 (default): On
@@ -322,6 +330,8 @@ dump_nso=false
 quest_flag =
 # Enables/Disables the macro JIT compiler
 disable_macro_jit=false
+# Records every GPU command list and the memory it uses to a trace in the log directory
+capture_gpu_trace=false
 
 [WebService]
 # Whether or not to enable telemetry